@@ -0,0 +1,19 @@
+extern unsigned char __VERIFIER_nondet_uchar();
+
+int main()
+{
+    unsigned char s[4];
+    for (int i = 0; i < 4; ++i)
+        s[i] = __VERIFIER_nondet_uchar();
+
+    // The bytes compared below are selected by the input. So, sensitivity analyses of different
+    // traces through the same node find different sensitive bits of the node, i.e., the node
+    // gains sensitive bits while it waits in the queue of coverage targets.
+    unsigned char const  idx = __VERIFIER_nondet_uchar() & 3U;
+    if (s[idx] == 'x')
+        if (s[(idx + 1U) & 3U] == 'y')
+            if (s[(idx + 2U) & 3U] == 'z')
+                return 1;
+
+    return 0;
+}
@@ -8,21 +8,30 @@
 #   include <memory>
 #   include <string>
 
+namespace iomodels { struct iomanager; }
+
 
 namespace connection {
 
 
+// Executes the target for the input in the stdin of the iomanager and loads the results of
+// the execution back to the iomanager. Each fuzzing campaign passes its own iomanager.
 struct  benchmark_executor
 {
+    explicit benchmark_executor(iomodels::iomanager&  io_) : io{ io_ } {}
     virtual  ~benchmark_executor() {}
     virtual void  operator()() = 0;
     virtual void  on_io_config_changed() {}
+
+protected:
+    iomodels::iomanager&  io;
 };
 
 
 struct  benchmark_executor_via_network : public benchmark_executor
 {
     benchmark_executor_via_network(
+            iomodels::iomanager&  io_,
             std::string const&  path_to_client,
             std::string const&  path_to_target,
             int const  port
@@ -38,7 +47,7 @@ private:
 
 struct  benchmark_executor_via_shared_memory : public benchmark_executor
 {
-    benchmark_executor_via_shared_memory(std::string const&  path_to_target);
+    benchmark_executor_via_shared_memory(iomodels::iomanager&  io_, std::string const&  path_to_target);
     ~benchmark_executor_via_shared_memory();
     void  operator()() override;
     void  on_io_config_changed() override;
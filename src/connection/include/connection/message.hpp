@@ -22,7 +22,7 @@ struct  message : public medium
 {
     message() : medium() {}
 
-    natural_32_bit size();
+    natural_32_bit size() const;
 
     void clear() override;
     bool empty();
@@ -9,11 +9,13 @@
 
 #   include <string>
 
+namespace iomodels { struct iomanager; }
+
 namespace  connection {
 
 struct  server
 {
-    server(uint16_t port);
+    server(uint16_t port, iomodels::iomanager& io_manager_);
     
     void  start();
     void  stop();
@@ -25,6 +27,7 @@ struct  server
 private:
     void  accept_connections();
 
+    iomodels::iomanager& io_manager;
     boost::asio::io_context io_context;
     std::thread io_context_thread;
     boost::asio::ip::tcp::acceptor acceptor;
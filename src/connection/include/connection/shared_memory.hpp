@@ -10,13 +10,13 @@
 #   include <connection/message.hpp>
 #   include <optional>
 #   include <stdexcept>
+#   include <string>
 
 namespace  connection {
 
 
 class shared_memory : public medium {
-    inline static const char* segment_name = "SBT-Fizzer_Shared_Memory";
-
+    std::string segment_name{ default_segment_name };
     boost::interprocess::shared_memory_object shm{};
     boost::interprocess::mapped_region region{};
     natural_32_bit cursor = 0;
@@ -25,15 +25,24 @@ class shared_memory : public medium {
 
 public:
 
+    inline static const char* default_segment_name = "SBT-Fizzer_Shared_Memory";
+    /*The environment variable passing the name of the segment to the target. The default
+      name is used, when the variable is not set.*/
+    inline static const char* segment_name_variable = "SBT_FIZZER_SHARED_MEMORY";
+
     shared_memory() : medium() {}
 
+    const std::string& get_segment_name() const { return segment_name; }
+    /*Must be called before 'open_or_create'.*/
+    void set_segment_name(std::string name) { segment_name = std::move(name); }
+
     natural_32_bit get_size() const;
     void set_size(natural_32_bit bytes);
     void clear() override;
 
     void open_or_create();
     void map_region();
-    static void remove();
+    void remove();
 
     bool can_accept_bytes(std::size_t n) const override;
     bool can_deliver_bytes(std::size_t n) const override;
@@ -44,6 +53,17 @@ public:
     void accept_bytes(message& src);
     void deliver_bytes(message& dest);
 
+    /*Reserves n bytes at the end of the saved data and returns a pointer to them,
+      or nullptr when the memory cannot accept them. Non-virtual; for hot paths.*/
+    natural_8_bit* reserve_bytes(std::size_t const n)
+    {
+        if (memory == nullptr || get_size() < *saved + n)
+            return nullptr;
+        natural_8_bit* const ptr = memory + *saved;
+        *saved += (natural_32_bit)n;
+        return ptr;
+    }
+
     bool exhausted() const;
 
     /*Interprets the first two bytes as termination type*/
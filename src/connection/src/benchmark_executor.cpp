@@ -5,15 +5,16 @@ namespace connection {
 
 
 benchmark_executor_via_network::benchmark_executor_via_network(
+        iomodels::iomanager&  io_,
         std::string const&  path_to_client,
         std::string const&  path_to_target,
         int const  port
         )
-    : benchmark_executor{}
+    : benchmark_executor{ io_ }
     , serv{ nullptr }
     , executor{ nullptr }
 {
-    serv = std::make_unique<server>(port);
+    serv = std::make_unique<server>(port, io);
     serv->start();
     executor = std::make_unique<client_executor>(
         5,
@@ -45,43 +46,46 @@ void benchmark_executor_via_network::operator()()
 }
 
 
-benchmark_executor_via_shared_memory::benchmark_executor_via_shared_memory(std::string const&  path_to_target)
-    : benchmark_executor{}
+benchmark_executor_via_shared_memory::benchmark_executor_via_shared_memory(
+        iomodels::iomanager&  io_,
+        std::string const&  path_to_target
+        )
+    : benchmark_executor{ io_ }
     , executor{ nullptr }
 {
     executor = std::make_unique<target_executor>(path_to_target);
-    executor->set_timeout(iomodels::iomanager::instance().get_config().max_exec_milliseconds);
-    executor->init_shared_memory(iomodels::iomanager::instance().get_config().required_shared_memory_size());
+    executor->set_timeout(io.get_config().max_exec_milliseconds);
+    executor->init_shared_memory(io.get_config().required_shared_memory_size());
 }
 
 
 benchmark_executor_via_shared_memory::~benchmark_executor_via_shared_memory()
 {
+    executor->get_shared_memory().remove();
     executor = nullptr;
-    shared_memory::remove();
 }
 
 
 void benchmark_executor_via_shared_memory::operator()()
 {
     executor->get_shared_memory().clear();
-    iomodels::iomanager::instance().get_config().save_target_config(executor->get_shared_memory());
-    iomodels::iomanager::instance().get_stdin()->save(executor->get_shared_memory());
-    iomodels::iomanager::instance().get_stdout()->save(executor->get_shared_memory());
+    io.get_config().save_target_config(executor->get_shared_memory());
+    io.get_stdin()->save(executor->get_shared_memory());
+    io.get_stdout()->save(executor->get_shared_memory());
     executor->execute_target();
-    iomodels::iomanager::instance().clear_trace();
-    iomodels::iomanager::instance().clear_br_instr_trace();
-    iomodels::iomanager::instance().get_stdin()->clear();
-    iomodels::iomanager::instance().get_stdout()->clear();
-    iomodels::iomanager::instance().load_results(executor->get_shared_memory());
+    io.clear_trace();
+    io.clear_br_instr_trace();
+    io.get_stdin()->clear();
+    io.get_stdout()->clear();
+    io.load_results(executor->get_shared_memory());
 }
 
 
 void benchmark_executor_via_shared_memory::on_io_config_changed()
 {
     executor->get_shared_memory().clear();
-    executor->init_shared_memory(iomodels::iomanager::instance().get_config().required_shared_memory_size());
-    executor->set_timeout(iomodels::iomanager::instance().get_config().max_exec_milliseconds);
+    executor->init_shared_memory(io.get_config().required_shared_memory_size());
+    executor->set_timeout(io.get_config().max_exec_milliseconds);
 }
 
 
@@ -5,7 +5,7 @@
 namespace  connection {
 
 
-natural_32_bit message::size() {
+natural_32_bit message::size() const {
     return header.size - cursor;
 }
 
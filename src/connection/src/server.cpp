@@ -11,7 +11,8 @@
 namespace  connection {
 
 
-server::server(uint16_t port):
+server::server(uint16_t port, iomodels::iomanager& io_manager_):
+    io_manager(io_manager_),
     acceptor(io_context, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port))
     {}
 
@@ -74,10 +75,10 @@ void server::accept_connections() {
 
 void  server::send_input_to_client(connection& connection) {
     message input_to_client;
-    iomodels::iomanager::instance().get_config().save_client_config(input_to_client);
-    iomodels::iomanager::instance().get_config().save_target_config(input_to_client);
-    iomodels::iomanager::instance().get_stdin()->save(input_to_client);
-    iomodels::iomanager::instance().get_stdout()->save(input_to_client);
+    io_manager.get_config().save_client_config(input_to_client);
+    io_manager.get_config().save_target_config(input_to_client);
+    io_manager.get_stdin()->save(input_to_client);
+    io_manager.get_stdout()->save(input_to_client);
     connection.send_message(input_to_client);
 }
 
@@ -86,11 +87,11 @@ void  server::receive_result_from_client(connection& connection) {
     message results_from_client;
     connection.receive_message(results_from_client);
 
-    iomodels::iomanager::instance().clear_trace();
-    iomodels::iomanager::instance().clear_br_instr_trace();
-    iomodels::iomanager::instance().get_stdin()->clear();
-    iomodels::iomanager::instance().get_stdout()->clear();
-    iomodels::iomanager::instance().load_results(results_from_client);
+    io_manager.clear_trace();
+    io_manager.clear_br_instr_trace();
+    io_manager.get_stdin()->clear();
+    io_manager.get_stdout()->clear();
+    io_manager.load_results(results_from_client);
 }
 
 
@@ -10,7 +10,7 @@ namespace  connection {
 
 
 void shared_memory::open_or_create() {
-    shm = bip::shared_memory_object(bip::open_or_create, segment_name, bip::read_write);
+    shm = bip::shared_memory_object(bip::open_or_create, segment_name.c_str(), bip::read_write);
 }
 
 
@@ -41,7 +41,7 @@ void shared_memory::map_region() {
 }   
 
 void shared_memory::remove() {
-    bip::shared_memory_object::remove(segment_name);
+    bip::shared_memory_object::remove(segment_name.c_str());
 }
 
 bool shared_memory::can_accept_bytes(std::size_t const n) const {
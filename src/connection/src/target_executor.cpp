@@ -1,6 +1,8 @@
 #include <boost/process.hpp>
 
 #include <connection/target_executor.hpp>
+#include <atomic>
+#include <string>
 
 
 namespace bp = boost::process;
@@ -21,11 +23,23 @@ static bool wait_for_wrapper(bp::child& process, const std::chrono::duration<Rep
 }
 
 
+/* Each executor has its own segment, so executors of campaigns running at once
+in one process do not overwrite data of each other. */
+static std::string unique_segment_name() {
+    static std::atomic<natural_32_bit> counter{ 0U };
+    return std::string(shared_memory::default_segment_name)
+        + "_" + std::to_string(boost::this_process::get_id())
+        + "_" + std::to_string(counter++);
+}
+
+
 target_executor::target_executor(std::string target_invocation)
     : timeout_ms{ 0 }
     , target_invocation(std::move(target_invocation))
     , shm{}
-{}
+{
+    shm.set_segment_name(unique_segment_name());
+}
 
 void target_executor::init_shared_memory(std::size_t const size) {
     get_shared_memory().open_or_create();
@@ -42,7 +56,12 @@ void target_executor::set_timeout(natural_16_bit const timeout_ms_)
 
 void target_executor::execute_target() {
     using namespace std::chrono_literals;
-    bp::child target = bp::child(target_invocation, bp::std_out > bp::null, bp::std_err > bp::null);
+    bp::child target = bp::child(
+        target_invocation,
+        bp::env[shared_memory::segment_name_variable] = get_shared_memory().get_segment_name(),
+        bp::std_out > bp::null,
+        bp::std_err > bp::null
+    );
     if (!wait_for_wrapper(target, std::chrono::milliseconds(timeout_ms))) {
         target.terminate();
         get_shared_memory().set_termination(target_termination::timeout);
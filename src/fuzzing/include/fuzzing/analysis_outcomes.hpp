@@ -3,6 +3,7 @@
 
 #   include <fuzzing/execution_trace.hpp>
 #   include <fuzzing/fuzzer.hpp>
+#   include <fuzzing/execution_cache.hpp>
 #   include <utility/math.hpp>
 #   include <vector>
 #   include <string>
@@ -19,7 +20,8 @@ struct analysis_outcomes
         NORMAL,
         SERVER_INTERNAL_ERROR,
         CLIENT_COMMUNICATION_ERROR,
-        UNCLASSIFIED_ERROR
+        UNCLASSIFIED_ERROR,
+        INTERRUPTED // Stopped on request; the checkpoint of the campaign was written.
     };
 
     struct output_statistics
@@ -27,6 +29,8 @@ struct analysis_outcomes
         natural_32_bit  num_generated_tests{ 0U };
         natural_32_bit  num_crashes{ 0U };
         natural_32_bit  num_boundary_violations{ 0U };
+        natural_32_bit  num_executions{ 0U };
+        natural_32_bit  num_cached_executions{ 0U }; // Results restored from the execution cache.
     };
 
     TERMINATION_TYPE  termination_type{ TERMINATION_TYPE::NORMAL };
@@ -41,8 +45,10 @@ struct analysis_outcomes
     input_flow_analysis::performance_statistics   input_flow_statistics{};
     bitshare_analysis::performance_statistics   bitshare_statistics{};
     local_search_analysis::performance_statistics   local_search_statistics{};
+    input_to_state_analysis::performance_statistics   input_to_state_statistics{};
     bitflip_analysis::performance_statistics   bitflip_statistics{};
     fuzzer::performance_statistics  fuzzer_statistics{};
+    execution_cache::performance_statistics  execution_cache_statistics{};
     std::unordered_map<std::string, output_statistics>  output_statistics{};
 };
 
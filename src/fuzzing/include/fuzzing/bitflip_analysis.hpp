@@ -3,6 +3,8 @@
 
 #   include <fuzzing/execution_trace.hpp>
 #   include <fuzzing/branching_node.hpp>
+#   include <fuzzing/checkpoint.hpp>
+#   include <fuzzing/progress_recorder.hpp>
 #   include <utility/random.hpp>
 #   include <unordered_set>
 
@@ -24,28 +26,32 @@ struct  bitflip_analysis
         std::size_t  start_calls{ 0 };
     };
 
-    bitflip_analysis();
+    bitflip_analysis(progress_recorder&  recorder_, natural_32_bit  random_seed);
 
     bool  is_ready() const { return state == READY; }
     bool  is_busy() const { return state == BUSY; }
 
     branching_node*  get_node() const { return node_ptr; }
 
-    void  start(std::unordered_set<branching_node*> const&  leaf_branchings);
+    void  start(branching_node_set const&  leaf_branchings);
     void  stop();
 
-    bool  generate_next_input(vecb&  bits_ref);
+    bool  generate_next_input(input_bits&  bits_ref);
 
     performance_statistics const&  get_statistics() const { return statistics; }
 
+    // Only the data kept between runs of the analysis are saved. It is loaded to a ready analysis.
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+    void  load_checkpoint(checkpoint_reader&  reader);
+
 private:
 
     bool  is_mutated_bit_index_valid() const;
     bool  is_mutated_type_index_valid() const;
-    bool  generate_next_typed_value(vecb&  bits_ref);
+    bool  generate_next_typed_value(input_bits&  bits_ref);
 
     template<typename T, int N>
-    bool  write_bits(vecb&  bits_ref, T const  (&values)[N]);
+    bool  write_bits(input_bits&  bits_ref, T const  (&values)[N]);
 
     STATE  state;
     branching_node*  node_ptr;
@@ -59,6 +65,7 @@ private:
     random_generator_for_natural_32_bit  rnd_generator;
 
     performance_statistics  statistics;
+    progress_recorder&  recorder;
 };
 
 
@@ -3,9 +3,12 @@
 
 #   include <fuzzing/execution_trace.hpp>
 #   include <fuzzing/branching_node.hpp>
-#   include <unordered_map>
+#   include <fuzzing/checkpoint.hpp>
+#   include <fuzzing/progress_recorder.hpp>
+#   include <fuzzing/location_id_map.hpp>
 #   include <array>
 #   include <deque>
+#   include <memory>
 
 
 namespace  fuzzing {
@@ -31,9 +34,10 @@ struct  bitshare_analysis
         std::size_t  num_locations{ 0 };
         std::size_t  num_insertions{ 0 };
         std::size_t  num_deletions{ 0 };
+        std::size_t  num_evictions{ 0 };
     };
 
-    bitshare_analysis();
+    bitshare_analysis(natural_32_bit  num_locations, progress_recorder&  recorder_);
 
     bool  is_ready() const { return state == READY; }
     bool  is_busy() const { return state == BUSY; }
@@ -43,24 +47,40 @@ struct  bitshare_analysis
     void  start(branching_node*  node_ptr, natural_32_bit  execution_id_);
     void  stop();
 
-    bool  generate_next_input(vecb&  bits_ref);
-    void  process_execution_results(execution_trace_pointer  trace_ptr);
+    bool  generate_next_input(input_bits&  bits_ref);
+    void  process_execution_results(stored_execution_trace const&  trace);
 
-    void  bits_available_for_branching(branching_node*  node_ptr, execution_trace_pointer  trace, stdin_bits_and_types_pointer  bits_and_types);
+    void  bits_available_for_branching(branching_node*  node_ptr, stored_execution_trace const&  trace, stdin_bits_and_types_pointer  bits_and_types);
 
     performance_statistics const&  get_statistics() const { return statistics; }
 
+    // Only the data kept between runs of the analysis are saved. It is loaded to a ready analysis.
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+    void  load_checkpoint(checkpoint_reader&  reader);
+
+    std::size_t  get_memory_bytes() const { return samples_bytes; }
+    // Drops the older half of samples of each location. It is lossy: the dropped samples cannot be
+    // rebuilt. Nothing is evicted while the analysis is busy. Returns the number of dropped samples.
+    std::size_t  evict_old_samples();
+
 private:
 
     static constexpr std::size_t  max_deque_size = 10;
 
+    static std::size_t  sample_bytes(input_bits const&  sample) { return sizeof(input_bits) + sample.num_bytes(); }
+
     STATE  state;
-    std::unordered_map<location_id::id_type, std::array<std::deque<vecb>, 2> >  cache;
+    using  samples_per_direction = std::array<std::deque<input_bits>, 2>;
+
+    location_id_map<std::unique_ptr<samples_per_direction> >  cache;
+    std::size_t  num_cached_locations;
+    std::size_t  samples_bytes;
     branching_node*  processed_node;
-    std::deque<vecb>*  samples_ptr;
+    std::deque<input_bits>*  samples_ptr;
     std::size_t  sample_index;
     natural_32_bit  execution_id;
     performance_statistics  statistics;
+    progress_recorder&  recorder;
 };
 
 
@@ -2,14 +2,22 @@
 #   define FUZZING_BRANCHING_NODE_HPP_INCLUDED
 
 #   include <fuzzing/execution_trace.hpp>
+#   include <fuzzing/trace_store.hpp>
 #   include <fuzzing/stdin_bits.hpp>
+#   include <fuzzing/stdin_bit_set.hpp>
+#   include <fuzzing/object_pool.hpp>
 #   include <array>
 #   include <vector>
 #   include <unordered_set>
+#   include <unordered_map>
 
 namespace  fuzzing {
 
 
+struct  checkpoint_writer;
+struct  checkpoint_reader;
+
+
 struct  branching_node final
 {
     struct  successor_pointer
@@ -28,6 +36,16 @@ struct  branching_node final
 
     using guid_type = natural_32_bit;
 
+    // Nodes (and their analysis data) are allocated from slab pools, because
+    // long campaigns create and destroy millions of them. The pools are shared
+    // by all campaigns of the process, so are their statistics.
+    static void*  operator new(std::size_t  size);
+    static void  operator delete(void*  ptr);
+    static object_pool_statistics  get_node_memory_statistics();
+    static object_pool_statistics  get_analysis_data_memory_statistics();
+    // The pool memory taken by one node including its analysis data.
+    static std::size_t  get_memory_bytes_per_node();
+
     branching_node(
             location_id  id_,
             trace_index_type  trace_index_,
@@ -35,12 +53,21 @@ struct  branching_node final
             bool  xor_like_branching_function_,
             BRANCHING_PREDICATE  branching_predicate_,
             branching_node*  predecessor_,
+            branching_node*  previous_occurrence_,
             stdin_bits_and_types_pointer  best_stdin_,
-            execution_trace_pointer  best_trace_,
-            br_instr_execution_trace_pointer  best_br_instr_trace_,
-            natural_32_bit  execution_number
+            stored_execution_trace  best_trace_,
+            stored_br_instr_execution_trace  best_br_instr_trace_,
+            cmp_operands_trace_pointer  best_cmp_operands_trace_,
+            natural_32_bit  execution_number,
+            guid_type  guid_
             );
 
+    // Checkpoints store the node without its best traces (they are restored as evicted) and
+    // without the pointers to successors (the caller links the nodes). The previous occurrence
+    // must be registered to the writer (reader) before the node is saved (loaded).
+    branching_node(checkpoint_reader&  reader, branching_node*  predecessor_, guid_type  guid_);
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+
     location_id const&  get_location_id() const { return id; }
     trace_index_type  get_trace_index() const { return trace_index; }
     natural_32_bit  get_num_stdin_bytes() const { return num_stdin_bytes; }
@@ -49,6 +76,8 @@ struct  branching_node final
     BRANCHING_PREDICATE  get_branching_predicate() const { return branching_predicate; }
 
     branching_node*  get_predecessor() const { return predecessor; }
+    // The nearest node on the path to the root with the same location id (nullptr, if there is none).
+    branching_node*  get_previous_occurrence() const { return data->previous_occurrence; }
     successor_pointer const&  successor(bool const  direction) const { return direction == false ? successors.front() : successors.back(); }
     successor_pointer&  successor(bool const  direction) { return direction == false ? successors.front() : successors.back(); }
 
@@ -60,15 +89,27 @@ struct  branching_node final
 
     bool  is_direction_unexplored(bool const  direction) const { return successor(direction).label == successor_pointer::NOT_VISITED; }
 
-    stdin_bits_and_types_pointer  get_best_stdin() const { return best_stdin; }
-    execution_trace_pointer  get_best_trace() const { return best_trace; }
-    br_instr_execution_trace_pointer  get_best_br_instr_trace() const { return best_br_instr_trace; }
-    branching_function_value_type  get_best_value() const { return best_trace->at(trace_index).value; }
+    stdin_bits_and_types_pointer  get_best_stdin() const { return data->best_stdin; }
+    stored_execution_trace const&  get_best_trace() const { return data->best_trace; }
+    stored_br_instr_execution_trace const&  get_best_br_instr_trace() const { return data->best_br_instr_trace; }
+    cmp_operands_trace_pointer  get_best_cmp_operands_trace() const { return data->best_cmp_operands_trace; }
+    branching_function_value_type  get_best_value() const { return data->best_value; }
+
+    // The traces of the best input may be evicted to save memory; they can be rebuilt
+    // by re-execution of the best input, which is kept.
+    bool  is_best_trace_evicted() const { return data->best_stdin != nullptr && data->best_trace.empty(); }
+    void  evict_best_trace();
+    void  restore_best_trace(
+            stored_execution_trace  trace_,
+            stored_br_instr_execution_trace  br_instr_trace_,
+            cmp_operands_trace_pointer  cmp_operands_trace_
+            );
 
     void  update_best_data(
             stdin_bits_and_types_pointer  stdin_,
-            execution_trace_pointer  trace_,
-            br_instr_execution_trace_pointer  br_instr_trace_,
+            stored_execution_trace  trace_,
+            stored_br_instr_execution_trace  br_instr_trace_,
+            cmp_operands_trace_pointer  cmp_operands_trace_,
             natural_32_bit  execution_id_
             );
     void  release_best_data(bool  also_sensitive_bits = false);
@@ -77,67 +118,95 @@ struct  branching_node final
     bool  was_bitshare_performed() const { return bitshare_performed; }
     bool  was_local_search_performed() const { return local_search_performed; }
     bool  has_unexplored_direction() const { return is_direction_unexplored(false) || is_direction_unexplored(true); }
-    bool  has_pending_analysis() const { return !sensitivity_performed || (!sensitive_stdin_bits.empty() && (!bitshare_performed || !local_search_performed)); }
+    bool  has_pending_analysis() const { return !sensitivity_performed || (!data->sensitive_stdin_bits.empty() && (!bitshare_performed || !local_search_performed)); }
     bool  is_closed() const { return closed; }
     void  set_closed(bool const  state = true) { closed = state; }
     bool  is_pending() const { return  has_unexplored_direction() && has_pending_analysis(); }
-    bool  is_iid_branching() const { return sensitivity_performed && sensitive_stdin_bits.empty(); }
+    bool  is_iid_branching() const { return sensitivity_performed && data->sensitive_stdin_bits.empty(); }
 
-    natural_32_bit  get_sensitivity_start_execution() const { return sensitivity_start_execution; }
-    natural_32_bit  get_bitshare_start_execution() const { return bitshare_start_execution; }
-    natural_32_bit  get_local_search_start_execution() const { return local_search_start_execution; }
-    natural_32_bit  get_best_value_execution() const { return best_value_execution; }
+    natural_32_bit  get_sensitivity_start_execution() const { return data->sensitivity_start_execution; }
+    natural_32_bit  get_bitshare_start_execution() const { return data->bitshare_start_execution; }
+    natural_32_bit  get_local_search_start_execution() const { return data->local_search_start_execution; }
+    natural_32_bit  get_best_value_execution() const { return data->best_value_execution; }
 
     void  set_sensitivity_performed(natural_32_bit  execution_id);
     void  set_bitshare_performed(natural_32_bit  execution_id);
     void  set_local_search_performed(natural_32_bit  execution_id);
 
-    std::unordered_set<stdin_bit_index> const&  get_sensitive_stdin_bits() const { return sensitive_stdin_bits; }
-    bool  insert_sensitive_stdin_bit(stdin_bit_index const  idx) { return sensitive_stdin_bits.insert(idx).second; }
+    stdin_bit_set const&  get_sensitive_stdin_bits() const { return data->sensitive_stdin_bits; }
+    bool  insert_sensitive_stdin_bits(stdin_bit_set const&  bits) { return data->sensitive_stdin_bits.unite(bits); }
 
     trace_index_type  get_max_successors_trace_index() const { return max_successors_trace_index; }
     void  set_max_successors_trace_index(trace_index_type const  idx) { max_successors_trace_index = idx; }
 
-    natural_32_bit  get_num_coverage_failure_resets() const { return num_coverage_failure_resets; }
+    natural_32_bit  get_num_coverage_failure_resets() const { return data->num_coverage_failure_resets; }
     void  perform_failure_reset();
 
     guid_type  guid() const { return guid__; }
 
+    // Unlike the addresses, the guids are the same in all runs. So, the iteration order
+    // of hash containers of nodes hashed by the guids does not change between runs.
+    struct  guid_hash
+    {
+        std::size_t  operator()(branching_node const* const  node) const { return std::hash<guid_type>{}(node->guid()); }
+    };
+
 private:
 
-    location_id  id;
-    trace_index_type  trace_index;
-    natural_32_bit  num_stdin_bytes;
-    bool  xor_like_branching_function;
-    BRANCHING_PREDICATE  branching_predicate;
+    // The data used only by analyses and by the selection of coverage targets.
+    // They are kept out of line, so that the traversals of the tree touch only
+    // the densely packed hot members below.
+    struct  analysis_data
+    {
+        static void*  operator new(std::size_t  size);
+        static void  operator delete(void*  ptr);
 
-    branching_node*  predecessor;
-    std::array<successor_pointer, 2>  successors;
+        branching_node*  previous_occurrence;
 
-    stdin_bits_and_types_pointer  best_stdin;
-    execution_trace_pointer  best_trace;
-    br_instr_execution_trace_pointer  best_br_instr_trace;
+        stdin_bits_and_types_pointer  best_stdin;
+        stored_execution_trace  best_trace;
+        stored_br_instr_execution_trace  best_br_instr_trace;
+        cmp_operands_trace_pointer  best_cmp_operands_trace;
+        branching_function_value_type  best_value; // Kept also when the best trace is evicted.
 
-    std::unordered_set<stdin_bit_index>  sensitive_stdin_bits;
+        stdin_bit_set  sensitive_stdin_bits;
 
-    bool  sensitivity_performed;
-    bool  bitshare_performed;
-    bool  local_search_performed;
-    bool  closed;
+        natural_32_bit  sensitivity_start_execution;
+        natural_32_bit  bitshare_start_execution;
+        natural_32_bit  local_search_start_execution;
+        natural_32_bit  best_value_execution;
+        natural_32_bit  num_coverage_failure_resets;
+    };
 
-    natural_32_bit  sensitivity_start_execution;
-    natural_32_bit  bitshare_start_execution;
-    natural_32_bit  local_search_start_execution;
-    natural_32_bit  best_value_execution;
+    static object_pool<branching_node>&  node_pool();
+    static object_pool<analysis_data>&  analysis_data_pool();
 
-    trace_index_type  max_successors_trace_index;
-    natural_32_bit  num_coverage_failure_resets;
+    location_id  id;
+    branching_node*  predecessor;
+    std::array<successor_pointer, 2>  successors;
 
+    trace_index_type  trace_index;
+    trace_index_type  max_successors_trace_index;
+    natural_32_bit  num_stdin_bytes;
     guid_type  guid__;
-    static guid_type  get_fresh_guid__();
+
+    BRANCHING_PREDICATE  branching_predicate;
+    bool  xor_like_branching_function : 1;
+    bool  sensitivity_performed : 1;
+    bool  bitshare_performed : 1;
+    bool  local_search_performed : 1;
+    bool  closed : 1;
+
+    std::unique_ptr<analysis_data>  data;
 };
 
 
+// The containers of nodes the fuzzer iterates when making decisions (see 'guid_hash').
+using  branching_node_set = std::unordered_set<branching_node*, branching_node::guid_hash>;
+template<typename  value_type>
+using  branching_node_map = std::unordered_map<branching_node*, value_type, branching_node::guid_hash>;
+
+
 }
 
 #endif
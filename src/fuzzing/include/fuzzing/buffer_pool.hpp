@@ -0,0 +1,138 @@
+#ifndef FUZZING_BUFFER_POOL_HPP_INCLUDED
+#   define FUZZING_BUFFER_POOL_HPP_INCLUDED
+
+#   include <fuzzing/object_pool.hpp>
+#   include <utility/assumptions.hpp>
+#   include <atomic>
+#   include <cstddef>
+#   include <functional>
+#   include <memory>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+struct  buffer_pool_statistics
+{
+    std::size_t  acquisitions{ 0 };
+    std::size_t  allocations{ 0 }; // Acquisitions which had to create a new object.
+    std::size_t  max_free_objects{ 0 };
+    // Memory of the acquired objects, as measured by the 'num_bytes' function of the pool.
+    std::size_t  live_bytes{ 0 };
+};
+
+
+// An allocator taking memory of objects of the type T from the object pool of the type.
+// It serves control blocks of shared pointers of the buffer pool below, so they do not
+// go to the general-purpose heap either. The pool is shared by all campaigns of the
+// process; a control block may be released by another thread than the one which
+// allocated it (see 'object_pool').
+template<typename T>
+struct  pool_allocator
+{
+    using  value_type = T;
+
+    pool_allocator() = default;
+    template<typename U>
+    pool_allocator(pool_allocator<U> const&) {}
+
+    T*  allocate(std::size_t const  n) { ASSUMPTION(n == 1UL); return static_cast<T*>(pool().allocate()); }
+    void  deallocate(T* const  ptr, std::size_t) { pool().deallocate(ptr); }
+
+    template<typename U>
+    bool  operator==(pool_allocator<U> const&) const { return true; }
+
+private:
+    static object_pool<T, 256UL>&  pool() { static object_pool<T, 256UL>  instance; return instance; }
+};
+
+
+// Objects of the type T shared by the pointers returned from 'acquire'. When the last pointer
+// to an object is released, the object is cleared by the 'reset' function (it should keep
+// the capacity of the object's buffers) and then kept for a later 'acquire'. So, objects
+// created once per execution are recycled instead of allocated again. At most 'max_free_objects'
+// objects are kept; the others are deleted. The pool must outlive all the acquired objects.
+// An acquired object is filled once and then only read, so the pool counts its memory on
+// acquisition and releases the same amount with the object.
+template<typename T>
+struct  buffer_pool
+{
+    buffer_pool(
+            std::function<void(T&)> const&  reset_,
+            std::function<std::size_t(T const&)> const&  num_bytes_,
+            std::size_t const  max_free_objects_ = 64UL
+            )
+        : reset{ reset_ }
+        , num_bytes{ num_bytes_ }
+        , max_free_objects{ max_free_objects_ }
+        , free_objects{}
+        , live_bytes{ 0UL }
+        , statistics{}
+    {
+        free_objects.reserve(max_free_objects);
+    }
+
+    buffer_pool(buffer_pool const&) = delete;
+    buffer_pool&  operator=(buffer_pool const&) = delete;
+
+    template<typename  fill_function>
+    std::shared_ptr<T>  acquire(fill_function const&  fill)
+    {
+        ++statistics.acquisitions;
+        std::unique_ptr<T>  object;
+        if (free_objects.empty())
+        {
+            object = std::make_unique<T>();
+            ++statistics.allocations;
+        }
+        else
+        {
+            object = std::move(free_objects.back());
+            free_objects.pop_back();
+        }
+        fill(*object);
+        std::size_t const  object_bytes{ num_bytes(*object) };
+        live_bytes.fetch_add(object_bytes, std::memory_order_relaxed);
+        return std::shared_ptr<T>{ object.release(), releaser{ this, object_bytes }, pool_allocator<T>{} };
+    }
+
+    buffer_pool_statistics  get_statistics() const
+    {
+        buffer_pool_statistics  result{ statistics };
+        result.live_bytes = live_bytes.load(std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+
+    struct  releaser
+    {
+        void  operator()(T* const  ptr) const { pool->release(ptr, object_bytes); }
+        buffer_pool*  pool;
+        std::size_t  object_bytes;
+    };
+
+    void  release(T* const  ptr, std::size_t const  object_bytes)
+    {
+        live_bytes.fetch_sub(object_bytes, std::memory_order_relaxed);
+        std::unique_ptr<T>  object{ ptr };
+        if (free_objects.size() >= max_free_objects)
+            return;
+        reset(*object);
+        free_objects.push_back(std::move(object));
+        if (statistics.max_free_objects < free_objects.size())
+            statistics.max_free_objects = free_objects.size();
+    }
+
+    std::function<void(T&)>  reset;
+    std::function<std::size_t(T const&)>  num_bytes;
+    std::size_t  max_free_objects;
+    std::vector<std::unique_ptr<T> >  free_objects;
+    std::atomic<std::size_t>  live_bytes; // The objects may be released from other threads.
+    buffer_pool_statistics  statistics;
+};
+
+
+}
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef FUZZING_CAMPAIGN_CONTEXT_HPP_INCLUDED
+#   define FUZZING_CAMPAIGN_CONTEXT_HPP_INCLUDED
+
+#   include <fuzzing/branching_node.hpp>
+#   include <fuzzing/progress_recorder.hpp>
+#   include <iomodels/iomanager.hpp>
+
+namespace  fuzzing {
+
+
+// The state of one fuzzing campaign shared by the fuzzing loop, the executors, and the analyses:
+// the I/O models with the configuration and the traces of the last execution, the progress
+// recorder, and the generator of ids of branching nodes. The context is passed explicitly to
+// all of them, so several campaigns (each with its own context) may run in one process.
+struct  campaign_context
+{
+    campaign_context();
+
+    campaign_context(campaign_context const&) = delete;
+    campaign_context&  operator=(campaign_context const&) = delete;
+
+    branching_node::guid_type  fresh_guid();
+
+    iomodels::iomanager  io;
+    progress_recorder  recorder;
+
+private:
+    branching_node::guid_type  last_guid;
+};
+
+
+}
+
+#endif
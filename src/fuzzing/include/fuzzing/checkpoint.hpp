@@ -0,0 +1,136 @@
+#ifndef FUZZING_CHECKPOINT_HPP_INCLUDED
+#   define FUZZING_CHECKPOINT_HPP_INCLUDED
+
+#   include <fuzzing/branching_node.hpp>
+#   include <fuzzing/instrumentation_types.hpp>
+#   include <fuzzing/stdin_bits.hpp>
+#   include <fuzzing/stdin_bit_set.hpp>
+#   include <utility/basic_numeric_types.hpp>
+#   include <utility/math.hpp>
+#   include <csignal>
+#   include <filesystem>
+#   include <iosfwd>
+#   include <sstream>
+#   include <string>
+#   include <type_traits>
+#   include <unordered_map>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+struct  checkpoint_config
+{
+    std::filesystem::path  pathname{}; // No checkpoints are written, when empty.
+    natural_32_bit  period_seconds{ 600 }; // Only on the stop request, when 0.
+    std::filesystem::path  resume_pathname{}; // The campaign starts from scratch, when empty.
+    // When the pointed value becomes non-zero (e.g. in a signal handler), the checkpoint
+    // is written after the current execution and fuzzing stops.
+    volatile std::sig_atomic_t const*  stop_request{ nullptr };
+};
+
+
+// Binary streams of checkpoints of fuzzing campaigns. Values are stored in the native
+// byte order and layout, so a checkpoint can be resumed only by the same build of the
+// server; the header written by the writer is checked by the reader.
+//
+// Tree nodes are referenced by indices in the order they were registered, so a node must
+// be registered (and so loaded) before any reference to it is written. Inputs shared by
+// nodes are written once; any further occurrence is written as the index of the first one.
+struct  checkpoint_writer
+{
+    explicit checkpoint_writer(std::ostream&  ostr_);
+
+    bool  good() const;
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void  write(T const&  value) { write_bytes(&value, sizeof(T)); }
+    void  write(location_id  id) { write(id.id); write(id.context_hash); }
+    void  write(std::string const&  value);
+    void  write(input_bits const&  bits);
+    void  write(stdin_bit_set const&  bits);
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void  write_vector(std::vector<T> const&  values)
+    {
+        write((natural_64_bit)values.size());
+        write_bytes(values.data(), values.size() * sizeof(T));
+    }
+
+    template<typename engine_type>
+    void  write_random_generator(engine_type const&  generator)
+    {
+        std::ostringstream  sstr;
+        sstr << generator;
+        write(sstr.str());
+    }
+
+    void  write_input(stdin_bits_and_types const*  input); // The input can be nullptr.
+    bool  is_input_written(stdin_bits_and_types const* const  input) const { return input_indices.contains(input); }
+
+    void  register_node(branching_node const*  node);
+    void  write_node(branching_node const*  node); // The node can be nullptr.
+
+private:
+    void  write_bytes(void const*  ptr, std::size_t  num_bytes);
+
+    std::ostream&  ostr;
+    std::unordered_map<branching_node const*, natural_32_bit>  node_indices;
+    std::unordered_map<stdin_bits_and_types const*, natural_32_bit>  input_indices;
+};
+
+
+// Throws 'std::runtime_error', when the stream is not a checkpoint, or it is truncated or corrupted.
+struct  checkpoint_reader
+{
+    explicit checkpoint_reader(std::istream&  istr_);
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    T  read() { T  value; read_bytes(&value, sizeof(T)); return value; }
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void  read(T&  value) { read_bytes(&value, sizeof(T)); }
+    location_id  read_location_id() { location_id::id_type const  id{ read<location_id::id_type>() }; return { id, read<location_id::context_type>() }; }
+    void  read(std::string&  value);
+    void  read(input_bits&  bits);
+    void  read(stdin_bit_set&  bits);
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void  read_vector(std::vector<T>&  values)
+    {
+        values.resize(read_size(sizeof(T)));
+        read_bytes(values.data(), values.size() * sizeof(T));
+    }
+
+    template<typename engine_type>
+    void  read_random_generator(engine_type&  generator)
+    {
+        std::string  state;
+        read(state);
+        std::istringstream  sstr{ state };
+        sstr >> generator;
+        check(!sstr.fail());
+    }
+
+    // The size of a collection to be read; it is checked against the remaining size of the stream.
+    std::size_t  read_size(std::size_t  min_bytes_per_element = 1UL);
+
+    stdin_bits_and_types_pointer  read_input();
+
+    void  register_node(branching_node*  node);
+    branching_node*  read_node();
+
+    void  check(bool  condition) const;
+
+private:
+    void  read_bytes(void*  ptr, std::size_t  num_bytes);
+
+    std::istream&  istr;
+    std::size_t  remaining_bytes;
+    std::vector<branching_node*>  nodes;
+    std::vector<stdin_bits_and_types_pointer>  inputs;
+};
+
+
+}
+
+#endif
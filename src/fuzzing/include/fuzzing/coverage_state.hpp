@@ -0,0 +1,101 @@
+#ifndef FUZZING_COVERAGE_STATE_HPP_INCLUDED
+#   define FUZZING_COVERAGE_STATE_HPP_INCLUDED
+
+#   include <fuzzing/instrumentation_types.hpp>
+#   include <fuzzing/execution_trace.hpp>
+#   include <utility/basic_numeric_types.hpp>
+#   include <cstddef>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+// The set of directions seen so far for each pair (location id, context hash), stored
+// as two bits per the pair. The location is covered, if both bits are set; if only one
+// bit is set, then the opposite direction is uncovered.
+// The pairs are kept in a flat array indexed directly by 'location_id::id_type'. Each slot
+// of the array holds the bits of the first context seen for the id inline; any further
+// contexts of the id go to a small open-addressing table owned by the id. So, a query
+// or an update is a direct array access (plus rarely a short linear probing) and it
+// never allocates, unless a new context of an id is seen.
+struct  coverage_state
+{
+    enum  VISIT_RESULT
+    {
+        ALREADY_COVERED,    // Both directions were already seen before.
+        STILL_UNCOVERED,    // The direction was already seen before, the opposite one was not.
+        DISCOVERED,         // The location was not seen before, so the opposite direction is now uncovered.
+        COVERED             // The opposite direction was already seen before, so the location is now covered.
+    };
+
+    explicit coverage_state(std::size_t  num_ids = 0U);
+
+    void  reserve_ids(std::size_t  num_ids);
+
+    VISIT_RESULT  visit(location_id  id, bool  direction);
+
+    // Marks the location as covered resp. the direction as uncovered; used to restore a snapshot.
+    void  insert_covered(location_id  id);
+    void  insert_uncovered(location_id  id, bool  uncovered_direction);
+
+    bool  is_covered(location_id  id) const { return get_bits(id) == BOTH_DIRECTIONS; }
+    bool  is_uncovered(location_id  id, bool  direction) const { return get_bits(id) == direction_bit(!direction); }
+
+    std::size_t  num_covered() const { return num_covered_; }
+    std::size_t  num_uncovered() const { return num_uncovered_; }
+
+    // Both snapshots are sorted.
+    void  collect_covered(std::vector<location_id>&  output) const;
+    void  collect_uncovered(std::vector<branching_location_and_direction>&  output) const;
+
+private:
+
+    using  bits_type = natural_8_bit;
+
+    static bits_type constexpr  NO_DIRECTION{ 0U };
+    static bits_type constexpr  BOTH_DIRECTIONS{ 3U };
+    static bits_type  direction_bit(bool const  direction) { return direction ? 2U : 1U; }
+
+    static natural_32_bit constexpr  NO_TABLE{ ~0U };
+
+    struct  context_entry
+    {
+        location_id::context_type  context_hash{ 0U };
+        bits_type  bits{ NO_DIRECTION }; // The value NO_DIRECTION marks an unused slot.
+    };
+
+    struct  id_entry
+    {
+        context_entry  first{};
+        natural_32_bit  table_index{ NO_TABLE };
+    };
+
+    // Open addressing with linear probing; the number of slots is a power of two
+    // and at most half of them is used.
+    struct  context_table
+    {
+        std::vector<context_entry>  slots{};
+        std::size_t  size{ 0UL };
+    };
+
+    bits_type  get_bits(location_id  id) const;
+    bits_type&  get_or_insert_bits(location_id  id);
+    void  update_bits(location_id  id, bits_type  new_bits);
+
+    static std::size_t  slot_index(location_id::context_type  context_hash, std::size_t  num_slots);
+    static context_entry*  find_slot(context_table&  table, location_id::context_type  context_hash);
+    static context_entry const*  find_slot(context_table const&  table, location_id::context_type  context_hash);
+
+    template<typename F>
+    void  for_each_entry(F const&  visitor) const;
+
+    std::vector<id_entry>  ids;
+    std::vector<context_table>  tables;
+    std::size_t  num_covered_;
+    std::size_t  num_uncovered_;
+};
+
+
+}
+
+#endif
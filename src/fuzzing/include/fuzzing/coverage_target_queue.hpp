@@ -0,0 +1,122 @@
+#ifndef FUZZING_COVERAGE_TARGET_QUEUE_HPP_INCLUDED
+#   define FUZZING_COVERAGE_TARGET_QUEUE_HPP_INCLUDED
+
+#   include <fuzzing/branching_node.hpp>
+#   include <fuzzing/checkpoint.hpp>
+#   include <fuzzing/location_id_map.hpp>
+#   include <utility/basic_numeric_types.hpp>
+#   include <cstddef>
+#   include <set>
+#   include <unordered_map>
+
+namespace  fuzzing {
+
+
+// A priority queue of coverage target nodes. The best node is the one at the location
+// selected the least number of times; ties are broken by the number of sensitive bits,
+// the distance of the node's input width class from the central one, the input width,
+// the trace index, and finally by the maximal trace index of successors (the greater
+// the better). Nodes are grouped to buckets per location (the selection count is shared
+// by all nodes at a location) and buckets are ordered by the count and their best node.
+// So, insert, erase, and selection of the best node (incl. the update of the count)
+// are all O(log n).
+//
+// The selection count of a location restarts from zero, when there was a selection
+// (i.e., a call to 'increment_count') while the location had no node in the queue.
+//
+// The maximal trace index of successors changes as the tree grows, so it is not a part
+// of the index; it is resolved only among nodes equal in all other keys.
+struct  coverage_target_queue
+{
+    using  input_width_class_function = natural_32_bit(*)(natural_32_bit);
+
+    coverage_target_queue(std::size_t  num_locations, input_width_class_function  input_width_class_);
+
+    bool  empty() const { return nodes.empty(); }
+    std::size_t  size() const { return nodes.size(); }
+    bool  contains(branching_node* const  node) const { return nodes.contains(node); }
+
+    // The flag is an arbitrary bit the owner associates with the node.
+    bool  get_flag(branching_node*  node) const;
+    void  set_flag(branching_node*  node);
+
+    // Returns false, if the node is already in the queue; the flag is not changed then.
+    bool  insert(branching_node*  node, bool  flag);
+    bool  erase(branching_node*  node);
+    // Updates the key of the node to its current sensitive bits; the flag and the selection
+    // count of its location are kept. Returns false, if the node is not in the queue.
+    bool  update(branching_node*  node);
+    void  clear();
+
+    // Returns nullptr for the empty queue. The selection count of the location
+    // of the returned node is NOT increased; call 'increment_count' for that.
+    // So, the caller may reject the node without affecting the queue.
+    branching_node*  get_best(natural_32_bit  max_input_width);
+    void  increment_count(branching_node*  node);
+
+    // The nodes must be registered to the writer (reader) before.
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+    void  load_checkpoint(checkpoint_reader&  reader); // The queue must be empty.
+
+    template<typename  callback_type>
+    void  for_each(callback_type const&  callback) const
+    {
+        for (auto const&  node_and_props : nodes)
+            callback(node_and_props.first, node_and_props.second.flag);
+    }
+
+private:
+
+    struct  node_key
+    {
+        natural_32_bit  num_sensitive_bits;
+        natural_32_bit  distance_to_central_input_width_class;
+        natural_32_bit  num_stdin_bytes;
+        trace_index_type  trace_index;
+        branching_node::guid_type  guid; // Not the address, so that the order is the same in all runs.
+        branching_node*  node;
+
+        bool  same_priority(node_key const&  other) const;
+        bool  operator<(node_key const&  other) const;
+    };
+
+    struct  node_props
+    {
+        node_key  key;
+        bool  flag;
+    };
+
+    struct  bucket_key
+    {
+        natural_32_bit  count;
+        node_key  best;
+        location_id::id_type  location;
+
+        bool  operator<(bucket_key const&  other) const;
+    };
+
+    struct  bucket
+    {
+        std::set<node_key>  nodes{};
+        natural_32_bit  count{ 0U };
+        natural_32_bit  epoch_emptied{ 0U };
+    };
+
+    node_key  make_key(branching_node*  node) const;
+    bucket_key  make_bucket_key(location_id::id_type  location, bucket const&  b) const;
+    void  insert_key(node_key const&  key);
+    void  erase_key(node_key const&  key);
+    void  set_central_input_width_class(natural_32_bit  input_width_class);
+
+    branching_node_map<node_props>  nodes;
+    location_id_map<bucket>  buckets;
+    std::set<bucket_key>  order;
+    input_width_class_function  input_width_class;
+    natural_32_bit  central_input_width_class;
+    natural_32_bit  epoch;
+};
+
+
+}
+
+#endif
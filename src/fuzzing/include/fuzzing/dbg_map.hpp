@@ -0,0 +1,46 @@
+#ifndef FUZZING_DBG_MAP_HPP_INCLUDED
+#   define FUZZING_DBG_MAP_HPP_INCLUDED
+
+#   include <instrumentation/dbg_map.hpp>
+#   include <utility/basic_numeric_types.hpp>
+#   include <boost/interprocess/file_mapping.hpp>
+#   include <boost/interprocess/mapped_region.hpp>
+#   include <filesystem>
+#   include <string_view>
+
+namespace  fuzzing {
+
+
+// The reader of the binary debug map files (see 'instrumentation::dbg_map_header'). The file
+// is mapped to memory as is, so lookups need neither a parse nor a copy of the file.
+struct  dbg_map
+{
+    dbg_map() = default;
+    explicit dbg_map(std::filesystem::path const&  pathname) { open(pathname); }
+
+    // Throws std::runtime_error, when the file cannot be mapped or it is malformed.
+    void  open(std::filesystem::path const&  pathname);
+    void  close();
+    bool  is_open() const { return header != nullptr; }
+
+    std::size_t  size() const { return header == nullptr ? 0U : header->num_entries; }
+    instrumentation::dbg_map_entry const*  begin() const { return entries; }
+    instrumentation::dbg_map_entry const*  end() const { return entries + size(); }
+
+    // Returns nullptr, when there is no entry for the passed id.
+    instrumentation::dbg_map_entry const*  find(natural_32_bit  id) const;
+    // The offset and the termination of names were checked in 'open'.
+    std::string_view  function_name(instrumentation::dbg_map_entry const&  entry) const { return names + entry.function_name; }
+
+private:
+    boost::interprocess::file_mapping  file{};
+    boost::interprocess::mapped_region  region{};
+    instrumentation::dbg_map_header const*  header{ nullptr };
+    instrumentation::dbg_map_entry const*  entries{ nullptr };
+    char const*  names{ nullptr };
+};
+
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 #   define FUZZING_DUMP_HPP_INCLUDED
 
 #   include <fuzzing/analysis_outcomes.hpp>
+#   include <fuzzing/dbg_map.hpp>
 #   include <fuzzing/optimization_outcomes.hpp>
 #   include <fuzzing/termination_info.hpp>
 #   include <iomodels/iomanager.hpp>
@@ -37,6 +38,14 @@ void  save_analysis_outcomes(
         std::string const&  benchmark,
         analysis_outcomes const&  results
         );
+// Source locations of the uncovered branchings, as found in the debug map of 'cond' instructions.
+void  print_uncovered_locations(std::ostream&  ostr, analysis_outcomes const&  results, dbg_map const&  cond_map);
+void  save_uncovered_locations(
+        std::filesystem::path const&  output_dir,
+        std::string const&  benchmark,
+        analysis_outcomes const&  results,
+        dbg_map const&  cond_map
+        );
 
 void  print_optimization_configuration(std::ostream&  ostr, optimizer::configuration const&  config);
 void  log_optimization_configuration(optimizer::configuration const&  config);
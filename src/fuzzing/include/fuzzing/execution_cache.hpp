@@ -0,0 +1,64 @@
+#ifndef FUZZING_EXECUTION_CACHE_HPP_INCLUDED
+#   define FUZZING_EXECUTION_CACHE_HPP_INCLUDED
+
+#   include <iomodels/iomanager.hpp>
+#   include <utility/basic_numeric_types.hpp>
+#   include <functional>
+#   include <list>
+#   include <string>
+#   include <string_view>
+#   include <unordered_map>
+
+namespace  fuzzing {
+
+
+// Results of executions of the target per input, shared by all analyses. So, an input generated
+// again (by the same or another analysis) is not executed again; its results are restored to
+// the iomanager instead. Inputs are compared by their effective bytes only (see the method
+// 'iomodels::stdin_base::num_effective_bytes'). The least recently used results are evicted
+// to keep the memory of the cache under the limit.
+struct  execution_cache
+{
+    struct  performance_statistics
+    {
+        std::size_t  lookups{ 0 };
+        std::size_t  hits{ 0 };
+        std::size_t  insertions{ 0 };
+        std::size_t  evictions{ 0 };
+        std::size_t  rejections{ 0 }; // Results larger than the whole cache.
+        std::size_t  max_bytes{ 0 };
+    };
+
+    execution_cache(iomodels::iomanager&  io_, std::size_t  max_bytes_); // The cache is disabled, when 0.
+
+    // Runs the executor for the input in the stdin of the iomanager, unless the results for
+    // the input are cached. Returns true, when the results were restored from the cache.
+    bool  execute(std::function<void()> const&  executor);
+
+    void  clear();
+
+    std::size_t  get_memory_bytes() const { return num_bytes; }
+    performance_statistics const&  get_statistics() const { return statistics; }
+
+private:
+    struct  entry
+    {
+        std::string  input;
+        iomodels::iomanager::execution_results  results;
+        std::size_t  num_bytes;
+    };
+
+    void  evict_least_recently_used();
+
+    iomodels::iomanager&  io;
+    std::size_t  max_bytes;
+    std::size_t  num_bytes;
+    std::list<entry>  entries; // The most recently used first.
+    std::unordered_map<std::string_view, std::list<entry>::iterator>  index; // Views of inputs of entries.
+    performance_statistics  statistics;
+};
+
+
+}
+
+#endif
@@ -19,6 +19,10 @@ struct  execution_record_writer
             );
     void  operator()(fuzzing::execution_record const&  record);
 
+    // Used to continue the numbering of tests of a resumed campaign.
+    natural_32_bit  get_test_counter() const { return test_counter; }
+    void  set_test_counter(natural_32_bit const  value) { test_counter = value; }
+
 private:
 
     bool  use_native_test_type;
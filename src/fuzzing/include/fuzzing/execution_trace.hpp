@@ -10,10 +10,12 @@ namespace  fuzzing {
 
 
 using  execution_trace = std::vector<branching_coverage_info>;
-using  execution_trace_pointer = std::shared_ptr<execution_trace>;
 
 using  br_instr_execution_trace = std::vector<br_instr_coverage_info>;
-using  br_instr_execution_trace_pointer = std::shared_ptr<br_instr_execution_trace>;
+
+// Sorted by 'trace_index'; only comparisons instrumented with the option 'cmp_operands' are present.
+using  cmp_operands_trace = std::vector<cmp_operands_info>;
+using  cmp_operands_trace_pointer = std::shared_ptr<cmp_operands_trace>;
 
 using  trace_index_type = natural_32_bit;
 static natural_32_bit constexpr  invalid_trace_index{ std::numeric_limits<trace_index_type>::max() };
@@ -28,6 +30,11 @@ inline bool  operator!=(execution_path const&  left, execution_path const&  righ
 
 natural_64_bit  compute_hash(execution_path const&  path);
 
+bool  is_same_record(branching_coverage_info const&  l, branching_coverage_info const&  r);
+bool  is_same_record(br_instr_coverage_info const&  l, br_instr_coverage_info const&  r);
+natural_64_bit  compute_hash(branching_coverage_info const&  info);
+natural_64_bit  compute_hash(br_instr_coverage_info const&  info);
+
 
 }
 
@@ -1,12 +1,22 @@
 #ifndef FUZZING_FUZZER_HPP_INCLUDED
 #   define FUZZING_FUZZER_HPP_INCLUDED
 
+#   include <fuzzing/campaign_context.hpp>
 #   include <fuzzing/termination_info.hpp>
+#   include <fuzzing/target_metadata.hpp>
+#   include <fuzzing/checkpoint.hpp>
+#   include <fuzzing/coverage_target_queue.hpp>
+#   include <fuzzing/loop_detection_cache.hpp>
+#   include <fuzzing/location_id_map.hpp>
+#   include <fuzzing/coverage_state.hpp>
 #   include <fuzzing/input_flow_analysis.hpp>
 #   include <fuzzing/bitshare_analysis.hpp>
 #   include <fuzzing/bitflip_analysis.hpp>
 #   include <fuzzing/local_search_analysis.hpp>
+#   include <fuzzing/input_to_state_analysis.hpp>
 #   include <fuzzing/execution_record.hpp>
+#   include <fuzzing/buffer_pool.hpp>
+#   include <fuzzing/execution_cache.hpp>
 #   include <fuzzing/instrumentation_types.hpp>
 #   include <sala/program.hpp>
 #   include <utility/math.hpp>
@@ -17,9 +27,12 @@
 #   include <unordered_map>
 #   include <chrono>
 #   include <memory>
+#   include <deque>
+#   include <functional>
 #   include <thread>
 #   include <mutex>
 #   include <limits>
+#   include <algorithm>
 
 namespace  fuzzing {
 
@@ -54,9 +67,52 @@ struct  fuzzer final
         std::size_t  strategy_iid_twins_others{ 0 };
         std::size_t  strategy_monte_carlo{ 0 };
         std::size_t  coverage_failure_resets{ 0 };
+        // Memory of tree nodes (including their out-of-line analysis data) taken from the node pools.
+        // Only the live bytes are of this campaign; the rest is of all campaigns of the process.
+        std::size_t  node_memory_live_bytes{ 0 };
+        std::size_t  node_memory_reserved_bytes{ 0 };
+        std::size_t  node_memory_max_live_nodes{ 0 };
+        float_64_bit  node_memory_fragmentation{ 0.0 };
+        // Chunks of stored execution traces; a shared chunk is one found already stored.
+        std::size_t  trace_chunks_created{ 0 };
+        std::size_t  trace_chunks_shared{ 0 };
+        std::size_t  trace_chunks_indexed{ 0 };
+        // Queries for loops along paths and the nodes walked to answer them.
+        std::size_t  loop_detection_queries{ 0 };
+        std::size_t  loop_detection_cached_nodes{ 0 };
+        std::size_t  loop_detection_nodes_walked{ 0 };
+        // Memory of the server per category. Each category is counted incrementally by the owner
+        // of the memory, so reading the counters is cheap (see 'measure_memory_usage').
+        std::size_t  memory_checks{ 0 };
+        std::size_t  memory_nodes_bytes{ 0 };
+        std::size_t  memory_traces_bytes{ 0 };
+        std::size_t  memory_inputs_bytes{ 0 };
+        std::size_t  memory_bitshare_bytes{ 0 };
+        std::size_t  memory_iid_histograms_bytes{ 0 };
+        std::size_t  memory_execution_cache_bytes{ 0 };
+        std::size_t  memory_budget_overruns{ 0 }; // Checks which ended still above the budget.
+        std::size_t  evicted_traces{ 0 };
+        std::size_t  rebuilt_traces{ 0 };
+        std::size_t  failed_rebuilds{ 0 };
+        std::size_t  evicted_bitshare_samples{ 0 };
+        // Inputs of the seed corpus executed at the startup and those which discovered or covered a branching.
+        std::size_t  seed_inputs{ 0 };
+        std::size_t  seed_inputs_contributing{ 0 };
+        // Objects of executions taken from the buffer pools and those the pools had to allocate.
+        std::size_t  buffer_acquisitions{ 0 };
+        std::size_t  buffer_allocations{ 0 };
+        float_64_bit  buffer_allocations_per_execution{ 0.0 };
+        // Records of traces mapped to the tree and those of them in the explored prefix of their trace.
+        std::size_t  trace_records_mapped{ 0 };
+        std::size_t  trace_records_in_explored_prefix{ 0 };
     };
 
-    fuzzer(termination_info const&  info, sala::Program const* sala_program_ptr_);
+    fuzzer(
+            campaign_context&  context_,
+            termination_info const&  info,
+            sala::Program const* sala_program_ptr_,
+            target_metadata const&  metadata
+            );
     ~fuzzer();
 
     sala::Program const* sala_program() const { return sala_program_ptr; }
@@ -66,29 +122,51 @@ struct  fuzzer final
 
     termination_info const& get_termination_info() const { return termination_props; }
 
-    natural_32_bit  num_remaining_driver_executions() const { return termination_props.max_executions - get_performed_driver_executions(); }
+    natural_32_bit  num_remaining_driver_executions() const
+    { return termination_props.max_executions - std::min(termination_props.max_executions, get_performed_driver_executions()); }
     float_64_bit  num_remaining_seconds() const { return (float_64_bit)termination_props.max_seconds - get_elapsed_seconds(); }
 
     natural_32_bit  get_performed_driver_executions() const { return num_driver_executions; }
     float_64_bit  get_elapsed_seconds() const { return std::chrono::duration<float_64_bit>(time_point_current - time_point_start).count(); }
 
-    std::unordered_set<location_id> const&  get_covered_branchings() const { return covered_branchings; }
-    std::unordered_set<branching_location_and_direction> const&  get_uncovered_branchings() const { return uncovered_branchings; }
+    coverage_state const&  get_coverage() const { return coverage; }
 
     bool  can_make_progress() const { return state != FINISHED; }
 
     bool  round_begin(TERMINATION_REASON&  termination_reason);
     std::pair<execution_record::execution_flags, std::string const&>  round_end();
 
+    // The executor runs the target for the input currently set to the stdin of the iomanager.
+    // It is used for rebuilding evicted traces of nodes; these executions do not count to
+    // 'max_executions' and they are not processed as regular executions.
+    void  set_rebuild_executor(std::function<void()> const&  executor) { rebuild_executor = executor; }
+
+    // The cache of results of executions is counted to 'max_server_megabytes'; it is the first
+    // to be cleared when the budget is exceeded. The cache must outlive the fuzzer.
+    void  set_execution_cache(execution_cache* const  cache) { execution_cache_ptr = cache; }
+
+    // The inputs are executed in the state STARTUP right after the startup (empty) input, i.e., before
+    // any analysis; they count to 'max_executions'. The method can be called only before the first round.
+    void  set_seed_inputs(std::vector<vecu8> const&  inputs);
+
+    // The checkpoint holds the whole state of the campaign, except analyses running at the time
+    // of saving (their nodes stay pending, so they are selected again after the load) and best
+    // traces of nodes (they are restored as evicted, so they are rebuilt on demand). Budgets
+    // are not saved; the performed executions and the elapsed time are.
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+    void  load_checkpoint(checkpoint_reader&  reader); // Only before the first round.
+
     void  enable_renderer(bool state);
     bool  is_renderer_enabled() const;
     void  render() const;
 
     input_flow_analysis::performance_statistics const&  get_input_flow_statistics() const { return input_flow_thread.get_statistics(); }
     bitshare_analysis::performance_statistics const&  get_bitshare_statistics() const { return bitshare.get_statistics(); }
-    local_search_analysis::performance_statistics const&  get_local_search_statistics() const { return local_search.get_statistics(); }
+    // Both are summed over all instances of the analyses (see 'local_search_slot').
+    local_search_analysis::performance_statistics  get_local_search_statistics() const;
+    input_to_state_analysis::performance_statistics  get_input_to_state_statistics() const;
     bitflip_analysis::performance_statistics const&  get_bitflip_statistics() const { return bitflip.get_statistics(); }
-    performance_statistics const&  get_fuzzer_statistics() const { return statistics; }
+    performance_statistics const&  get_fuzzer_statistics() const;
 
 private:
 
@@ -101,13 +179,36 @@ private:
         FINISHED
     };
 
+    // An instance of the local search together with the input-to-state analysis, which runs
+    // before it on the same node. In the state LOCAL_SEARCH up to 'max_local_searches' instances
+    // run at once, each on a different node. Their inputs are generated in turns and results
+    // of each execution go back to the instance which generated the input. The tree is never
+    // shrunk while any instance is busy (the cleanup runs only when all of them are ready).
+    struct  local_search_slot
+    {
+        local_search_slot(progress_recorder&  recorder, natural_32_bit const  random_seed) : local_search{ recorder, random_seed } {}
+        input_to_state_analysis  input_to_state{};
+        local_search_analysis  local_search;
+        bool  cleanup_pending{ false }; // The node of the search was not yet processed by 'on_local_search_finished'.
+    };
+
     struct  coverage_progress_control_props
     {
         explicit  coverage_progress_control_props(fuzzer* fuzzer_ptr_);
         bool  is_analysis_interrupted() const { return interrupted_state != BITFLIP; }
-        bool  is_period_exceeded() const { return fuzzer_ptr->get_elapsed_seconds() - phase_start_time >= TIME_PERIOD; }
+        bool  is_period_exceeded() const
+        {
+            if (fuzzer_ptr->termination_props.deterministic)
+                return fuzzer_ptr->num_driver_executions - phase_start_execution >= EXECUTIONS_PERIOD;
+            return fuzzer_ptr->get_elapsed_seconds() - phase_start_time >= TIME_PERIOD;
+        }
         bool  nothing_covered() const { return num_covered_branchings == 0U; }
-        void  reset_period() { phase_start_time = fuzzer_ptr->get_elapsed_seconds(); num_covered_branchings = 0U; }
+        void  reset_period()
+        {
+            phase_start_time = fuzzer_ptr->get_elapsed_seconds();
+            phase_start_execution = fuzzer_ptr->num_driver_executions;
+            num_covered_branchings = 0U;
+        }
         float_64_bit  get_phase_start_time() const { return phase_start_time; }
         natural_32_bit  get_num_covered_branchings() const { return num_covered_branchings; }
         void  increment_num_covered_branchings() { ++num_covered_branchings; }
@@ -115,8 +216,10 @@ private:
         void  interruption_exit();
     private:
         static float_64_bit constexpr TIME_PERIOD{ 10.0 };
+        static natural_32_bit constexpr EXECUTIONS_PERIOD{ 10000U }; // Replaces TIME_PERIOD in the deterministic mode.
         fuzzer*  fuzzer_ptr;
         float_64_bit  phase_start_time;
+        natural_32_bit  phase_start_execution;
         natural_32_bit  num_covered_branchings;
         STATE  interrupted_state;
     };
@@ -128,6 +231,18 @@ private:
         bool  any_location_discovered{ false };
         std::unordered_set<location_id>  covered_locations{};
         std::unordered_map<location_id, std::unordered_set<branching_node*> >  uncovered_locations{};
+        std::unordered_map<location_id, branching_node*>  last_occurrences{}; // Along the mapped trace.
+    };
+
+    // Changes of the tree since the last cleanup, recorded while traces are mapped
+    // to the tree. So, the cleanup visits only the changed parts of the tree.
+    struct  tree_change_events
+    {
+        void  clear() { leaves_with_successors.clear(); dead_nodes.clear(); covered_locations.clear(); }
+
+        std::vector<branching_node*>  leaves_with_successors{};   // Members of 'leaf_branchings' which got a successor.
+        branching_node_set  dead_nodes{};                        // Nodes with both directions explored.
+        std::vector<location_id>  covered_locations{};          // Locations with both directions covered.
     };
 
     struct  primary_coverage_target_branchings
@@ -135,60 +250,63 @@ private:
         primary_coverage_target_branchings(
                 std::function<bool(location_id)> const&  is_covered_,
                 std::function<branching_node*(location_id)> const&  iid_pivot_with_lowest_abs_value_,
-                performance_statistics*  statistics_ptr_
+                loop_detection_cache*  loop_detection_ptr_,
+                performance_statistics*  statistics_ptr_,
+                progress_recorder*  recorder_ptr_,
+                natural_32_bit  num_locations
                 );
 
         void  collect_loop_heads_along_path_to_node(branching_node* const  end_node);
         void  process_potential_coverage_target(std::pair<branching_node*, bool> const&  node_and_flag);
         void  erase(branching_node*  node);
+        void  update(branching_node*  node); // After a change of sensitive bits of the node.
 
         bool  empty() const;
         void  clear();
 
         void  do_cleanup();
-        branching_node*  get_best_sensitive(natural_32_bit  max_input_width);
+        // The 'accept' predicate is applied to a candidate before it is counted as selected (in statistics,
+        // the recorder, and the queue). When rejected, the next strategy is tried, and nothing is changed.
+        branching_node*  get_best_sensitive(
+                natural_32_bit  max_input_width,
+                std::function<bool(branching_node*)> const&  accept = [](branching_node*) { return true; }
+                );
         branching_node*  get_best_others(natural_32_bit  max_input_width);
 
         std::size_t  num_sensitive_targets() const { return loop_heads_sensitive.size() + sensitive.size(); }
 
-        std::unordered_set<branching_node*> const&  get_loop_heads_sensitive() const { return loop_heads_sensitive; }
-        std::unordered_set<branching_node*> const&  get_loop_heads_others() const { return loop_heads_others; }
-        std::unordered_map<branching_node*, bool> const&  get_sensitive() const { return sensitive; }
-        std::unordered_map<branching_node*, bool> const&  get_untouched() const { return untouched; }
+        void  save_checkpoint(checkpoint_writer&  writer) const;
+        void  load_checkpoint(checkpoint_reader&  reader); // Only when empty() == true
+
+        branching_node_set const&  get_loop_heads_sensitive() const { return loop_heads_sensitive; }
+        branching_node_set const&  get_loop_heads_others() const { return loop_heads_others; }
+        coverage_target_queue const&  get_sensitive() const { return sensitive; }
+        coverage_target_queue const&  get_untouched() const { return untouched; }
         std::unordered_map<location_id, std::pair<branching_node*, bool> > const&  get_iid_twins_sensitive() const { return iid_twins_sensitive; }
         std::unordered_map<location_id, std::pair<branching_node*, bool> > const&  get_iid_twins_others() const { return iid_twins_others; }
-        std::unordered_map<location_id::id_type, natural_32_bit> const&  get_sensitive_counts() const { return sensitive_counts; }
-        std::unordered_map<location_id::id_type, natural_32_bit> const&  get_untouched_counts() const { return untouched_counts; }
 
     private:
-        static void  update_counts(
-                std::unordered_map<location_id::id_type, natural_32_bit>&  counts,
-                std::unordered_map<branching_node*, bool> const&  data
-                );
-        branching_node*  get_best(
-                std::unordered_map<branching_node*, bool>&  targets,
-                std::unordered_map<location_id::id_type, natural_32_bit>&  counts,
-                natural_32_bit  max_input_width
-                );
+        branching_node*  get_best(coverage_target_queue&  targets, natural_32_bit  max_input_width);
+        void  select(coverage_target_queue&  targets, branching_node*  node);
 
-        std::unordered_set<branching_node*>  loop_heads_sensitive;  // Priority #1 (the highest)
-        std::unordered_set<branching_node*>  loop_heads_others;     // Priority #1.1
-        std::unordered_map<branching_node*, bool>  sensitive;   // Priority #2
-        std::unordered_map<branching_node*, bool>  untouched;   // Priority #3
+        branching_node_set  loop_heads_sensitive;  // Priority #1 (the highest)
+        branching_node_set  loop_heads_others;     // Priority #1.1
+        coverage_target_queue  sensitive;   // Priority #2
+        coverage_target_queue  untouched;   // Priority #3
         std::unordered_map<location_id, std::pair<branching_node*, bool> >  iid_twins_sensitive;    // Priority #4
         std::unordered_map<location_id, std::pair<branching_node*, bool> >  iid_twins_others;       // Priority #4.1
-        std::unordered_map<location_id::id_type, natural_32_bit>  sensitive_counts;
-        std::unordered_map<location_id::id_type, natural_32_bit>  untouched_counts;
         natural_32_bit  sensitive_start_index;
         natural_32_bit  untouched_start_index;
         std::function<bool(location_id)>  is_covered;
         std::function<branching_node*(location_id)>  iid_pivot_with_lowest_abs_value;
+        loop_detection_cache*  loop_detection;
         performance_statistics*  statistics;
+        progress_recorder*  recorder;
     };
 
     struct  input_flow_analysis_thread
     {
-        input_flow_analysis_thread(sala::Program const* sala_program_ptr);
+        input_flow_analysis_thread(sala::Program const* sala_program_ptr, iomodels::iomanager const&  io);
 
         bool  is_ready() const;
         bool  is_busy() const;
@@ -200,9 +318,12 @@ private:
 
         void  stop();
 
+        // Blocks till the running computation (if any) finishes.
+        void  wait_until_finished() const;
+
         // Two methods below can be called only when: is_ready() == true 
         branching_node*  get_node() const;
-        std::unordered_set<branching_node*> const&  get_changed_nodes();
+        branching_node_set const&  get_changed_nodes();
 
         // The method below can be called only when: is_finished() == true 
         void  apply_results(branching_node*  entry_node);
@@ -210,6 +331,11 @@ private:
         // The method below can be called only when: is_terminated() == true || is_busy() == false
         input_flow_analysis::performance_statistics const&  get_statistics() const;
 
+        // The statistics are not saved, while the analysis is computing.
+        void  save_checkpoint(checkpoint_writer&  writer) const;
+        // The method below can be called only when: is_ready() == true 
+        void  load_checkpoint(checkpoint_reader&  reader);
+
     private:
 
         enum STATE
@@ -224,7 +350,7 @@ private:
         struct computation_request
         {
             input_flow_analysis::computation_io_data  data{};
-            std::unordered_set<branching_node*>  changed_nodes{};
+            branching_node_set  changed_nodes{};
             branching_node*  last_node{ nullptr };
             natural_32_bit  execution_id{ 0U };
             float_64_bit  remaining_seconds{ 0.0 };
@@ -251,55 +377,97 @@ private:
         natural_32_bit  hit_count[2];
     };
 
+    // Histograms of hit counts of directions along paths to IID pivots collected from one
+    // sensitivity analysis. Pivots are sorted by the trace index, so the histogram of each
+    // pivot extends the one of the previous pivot; the histograms are versions 0, 1, ...
+    // of a persistent per-location array: each location keeps the list of its counts
+    // in the versions where they changed. So, the counts of a location in any version
+    // are found by a binary search, without walking or merging the preceding versions.
     struct  histogram_of_hit_counts_per_direction
     {
-        using  hit_counts_map = std::unordered_map<location_id::id_type, hit_count_per_direction>;
         using  pointer_type = std::shared_ptr<histogram_of_hit_counts_per_direction>;
+        using  version_type = natural_32_bit;
+
+        // All histograms of the fuzzer share the counter of their memory (see 'count_memory_bytes').
+        static inline pointer_type  create(std::shared_ptr<std::size_t> const&  live_bytes)
+        { return std::make_shared<histogram_of_hit_counts_per_direction>(live_bytes); }
+
+        explicit histogram_of_hit_counts_per_direction(std::shared_ptr<std::size_t> const&  live_bytes_)
+            : history{}, changes{}, live_bytes{ live_bytes_ }, counted_bytes{ 0UL }
+        {}
+        histogram_of_hit_counts_per_direction(histogram_of_hit_counts_per_direction const&) = delete;
+        histogram_of_hit_counts_per_direction&  operator=(histogram_of_hit_counts_per_direction const&) = delete;
+        ~histogram_of_hit_counts_per_direction() { *live_bytes -= counted_bytes; }
+
+        version_type  num_versions() const { return (version_type)changes.size(); }
+        // The new version starts with the counts of the previous one.
+        version_type  push_version() { changes.push_back({}); return num_versions() - 1U; }
+        // The counts of the location in the last version.
+        hit_count_per_direction&  at_last_version(location_id::id_type  id);
+
+        // Returns nullptr, if the location was not hit in the version or before.
+        hit_count_per_direction const*  find(location_id::id_type  id, version_type  version) const;
+        // Locations whose counts changed in the version.
+        std::vector<location_id::id_type> const&  changed_locations(version_type const  version) const { return changes.at(version); }
+
+        std::size_t  get_memory_bytes() const;
+        // Updates the shared counter by the memory of the histogram. Histograms are built at once
+        // and then only read, so it is called when the histogram is complete.
+        void  count_memory_bytes();
 
-        static inline pointer_type  create(pointer_type  predecessor_ptr_)
-        { return std::make_shared<histogram_of_hit_counts_per_direction>(predecessor_ptr_); }
-
-        histogram_of_hit_counts_per_direction(pointer_type const  ptr) : hit_counts{}, predecessor_ptr{ ptr } {}
-        hit_counts_map const&  local_hit_counts() const { return hit_counts; }
-        hit_counts_map&  local_hit_counts_ref() { return hit_counts; }
-        pointer_type  get_predecessor() const { return predecessor_ptr; }
-        void  merge(hit_counts_map&  result) const { merge(this, nullptr, result); }
     private:
-        static void  merge(
-                histogram_of_hit_counts_per_direction const*  histogram,
-                histogram_of_hit_counts_per_direction const* const  end,
-                hit_counts_map&  result
-                );
-        hit_counts_map  hit_counts;
-        pointer_type  predecessor_ptr;
-    };
+        using  version_and_counts = std::pair<version_type, hit_count_per_direction>;
 
-    struct  probability_generator
-    {
-        virtual ~probability_generator() {}
-        virtual float_32_bit  next() = 0;
+        location_id_map<std::vector<version_and_counts> >  history;
+        std::vector<std::vector<location_id::id_type> >  changes;
+        std::shared_ptr<std::size_t>  live_bytes;
+        std::size_t  counted_bytes;
     };
 
-    struct  probability_generator_random_uniform : public probability_generator
-    {
-        probability_generator_random_uniform(random_generator_for_natural_32_bit&  random_generator) : generator{ random_generator } {}
-        float_32_bit  next() override { return get_random_float_32_bit_in_range(0.0f, 1.0f, generator); }
-    private:
-        random_generator_for_natural_32_bit&  generator;
-    };
+    using  histogram_of_false_direction_probabilities = std::unordered_map<location_id::id_type, float_32_bit>;
 
-    struct  probability_generator_all_then_all : public probability_generator
+    // The data of a Monte Carlo walk through the tree precomputed for all locations of the
+    // selected IID pivot: the probability of the false direction and the kind of sampling
+    // per location in a flat array indexed by the location id, and the states of samplers
+    // inline. So, a step of the walk does neither hashing nor a virtual call.
+    struct  monte_carlo_sampling_table
     {
-        probability_generator_all_then_all(float_32_bit  false_direction_probability_, natural_32_bit  total_num_samples_, bool  first_direction_);
-        float_32_bit  next() override;
+        enum SAMPLING : natural_8_bit
+        {
+            UNIFORM                     = 0,    // Random samples in [0, 1].
+            ALL_FALSE_THEN_ALL_TRUE     = 1,    // Periodically all samples of the false direction, then all of the true one.
+            ALL_TRUE_THEN_ALL_FALSE     = 2
+        };
+
+        explicit monte_carlo_sampling_table(random_generator_for_natural_32_bit&  uniform_generator_);
+
+        void  insert(location_id::id_type  id, float_32_bit  false_direction_probability, SAMPLING  sampling, natural_32_bit  total_num_samples);
+
+        // Locations not inserted to the table have the probability 0.5 and the uniform sampling.
+        bool  sample_direction(location_id::id_type  id);
+
     private:
-        natural_32_bit  samples_total[2];
-        natural_32_bit  samples_consumed[2];
-        bool  direction;
-    };
+        struct  location_props
+        {
+            float_32_bit  false_direction_probability{ 0.5f };
+            natural_32_bit  sampler_index{ UNIFORM_SAMPLER };
+        };
 
-    using  histogram_of_false_direction_probabilities = std::unordered_map<location_id::id_type, float_32_bit>;
-    using  probability_generators_for_locations = std::unordered_map<location_id::id_type, std::shared_ptr<probability_generator> >;
+        struct  all_then_all_sampler
+        {
+            natural_32_bit  samples_total[2];
+            natural_32_bit  samples_consumed[2];
+            bool  direction;
+        };
+
+        static natural_32_bit constexpr  UNIFORM_SAMPLER{ std::numeric_limits<natural_32_bit>::max() };
+
+        float_32_bit  next_sample(natural_32_bit  sampler_index);
+
+        location_id_map<location_props>  locations;
+        std::vector<all_then_all_sampler>  samplers;
+        random_generator_for_natural_32_bit&  uniform_generator;
+    };
 
     struct  loop_boundary_props
     {
@@ -313,20 +481,21 @@ private:
         std::vector<branching_node*>  loop_boundaries;
         std::unordered_set<location_id>  pure_loop_bodies;
         histogram_of_hit_counts_per_direction::pointer_type  histogram_ptr;
+        histogram_of_hit_counts_per_direction::version_type  histogram_version{ 0U };
         mutable random_generator_for_natural_32_bit  generator_for_start_node_selection;
         mutable random_generator_for_natural_32_bit  generator_for_monte_carlo;
     };
 
     struct  iid_location_props
     {
-        std::unordered_map<branching_node*, iid_pivot_props>  pivots;
+        branching_node_map<iid_pivot_props>  pivots;
         branching_node*  pivot_with_lowest_abs_value{ nullptr };
         mutable random_generator_for_natural_32_bit  generator_for_pivot_selection;
     };
 
     static std::string const&  get_analysis_name_from_state(STATE state);
 
-    static void  update_close_flags_from(branching_node*  node);
+    void  update_close_flags_from(branching_node*  node);
 
     static std::vector<natural_32_bit> const&  get_input_width_classes();
     static std::unordered_set<natural_32_bit> const&  get_input_width_classes_set();
@@ -343,8 +512,8 @@ private:
             std::vector<branching_node*>&  loop_boundaries
             );
 
-    static std::unordered_map<branching_node*, iid_pivot_props>::const_iterator  select_best_iid_pivot(
-            std::unordered_map<branching_node*, iid_pivot_props> const&  pivots,
+    static branching_node_map<iid_pivot_props>::const_iterator  select_best_iid_pivot(
+            branching_node_map<iid_pivot_props> const&  pivots,
             natural_32_bit  max_input_width,
             random_generator_for_natural_32_bit&  random_generator,
             float_32_bit const  LIMIT_STEP = 0.5f
@@ -353,7 +522,7 @@ private:
     static void  compute_histogram_of_false_direction_probabilities(
             natural_32_bit const  input_width,
             std::unordered_set<location_id> const&  pure_loop_bodies,
-            std::unordered_map<branching_node*, iid_pivot_props> const&  pivots,
+            branching_node_map<iid_pivot_props> const&  pivots,
             histogram_of_false_direction_probabilities&  histogram
             );
 
@@ -364,42 +533,55 @@ private:
             branching_node*  fallback_node = nullptr
             );
 
-    static std::shared_ptr<probability_generator_random_uniform>  compute_probability_generators_for_locations(
+    static void  compute_monte_carlo_sampling_table(
             histogram_of_false_direction_probabilities const&  probabilities,
-            histogram_of_hit_counts_per_direction::hit_counts_map const&  hit_counts,
+            histogram_of_hit_counts_per_direction const&  hit_counts,
+            histogram_of_hit_counts_per_direction::version_type  hit_counts_version,
             std::unordered_set<location_id> const&  pure_loop_bodies,
-            probability_generators_for_locations&  generators,
-            random_generator_for_natural_32_bit&  generator_for_generator_selection,
-            random_generator_for_natural_32_bit&  generator_for_generators
+            monte_carlo_sampling_table&  table,
+            random_generator_for_natural_32_bit&  generator_for_sampling_selection
             );
 
-    static branching_node*  monte_carlo_search(
-            branching_node*  root,
-            histogram_of_false_direction_probabilities const&  histogram,
-            probability_generators_for_locations const&  generators,
-            probability_generator_random_uniform&  location_miss_generator
-            );
+    static branching_node*  monte_carlo_search(branching_node*  root, monte_carlo_sampling_table&  table);
     static std::pair<branching_node*, bool>  monte_carlo_backward_search(
             branching_node* const  start_node,
             branching_node* const  end_node,
-            histogram_of_false_direction_probabilities const&  histogram,
-            probability_generators_for_locations const&  generators,
-            probability_generator_random_uniform&  location_miss_generator
-            );
-    static branching_node*  monte_carlo_step(
-            branching_node* const  pivot,
-            histogram_of_false_direction_probabilities const&  histogram,
-            probability_generators_for_locations const&  generators,
-            probability_generator_random_uniform&  location_miss_generator
+            monte_carlo_sampling_table&  table
             );
+    static branching_node*  monte_carlo_step(branching_node* const  pivot, monte_carlo_sampling_table&  table);
 
-    bool  generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termination_reason);
+    bool  generate_next_input(input_bits&  stdin_bits, TERMINATION_REASON&  termination_reason);
     execution_record::execution_flags  process_execution_results();
+    stored_execution_trace  store_execution_trace();
+    cmp_operands_trace_pointer  acquire_cmp_operands_trace();
+    void  map_explored_prefix_record(
+            branching_node*  node,
+            branching_coverage_info const&  info,
+            stored_execution_trace const&  trace,
+            stdin_bits_and_types_pointer const&  bits_and_types,
+            stored_br_instr_execution_trace const&  br_instr_trace,
+            cmp_operands_trace_pointer const&  cmp_operands
+            );
+
+    std::size_t  measure_memory_usage() const;
+    void  collect_eviction_candidates(std::vector<branching_node*>&  candidates) const;
+    void  enforce_memory_budget();
+    bool  rebuild_best_trace(branching_node*  node);
 
     void  do_cleanup();
     void  do_cleanup_iid_pivots();
     void  collect_iid_pivots_from_sensitivity_results();
     void  select_next_state();
+    void  start_local_search(local_search_slot&  slot, branching_node*  winner);
+    void  on_local_search_finished(local_search_slot&  slot);
+    bool  refill_local_search_slot(std::size_t  index);
+    bool  generate_next_local_search_input(input_bits&  stdin_bits);
+    void  activate_local_search_slot(std::size_t  index);
+    void  stop_local_searches_without_unexplored_direction();
+    local_search_slot&  active_local_search_slot() { return local_search_slots.at(active_local_search_slot_index); }
+    local_search_slot const&  active_local_search_slot() const { return local_search_slots.at(active_local_search_slot_index); }
+    bool  is_any_local_search_busy() const;
+    bool  is_processed_by_local_search(branching_node const*  node) const;
     branching_node*  select_iid_coverage_target() const;
 
     bool  try_start_input_flow_analysis(branching_node*  winner);
@@ -407,33 +589,54 @@ private:
     void  remove_leaf_branching_node(branching_node*  node);
     bool  apply_coverage_failures_with_hope();
 
+    progress_recorder&  recorder() const { return context.recorder; }
+
+    campaign_context&  context;
     sala::Program const* sala_program_ptr;
 
     termination_info termination_props;
+    target_metadata  target_props;
 
     natural_32_bit  num_driver_executions;
     std::chrono::steady_clock::time_point  time_point_start;
     std::chrono::steady_clock::time_point  time_point_current;
 
+    // Buffers of each execution, recycled across executions. The pools are declared before
+    // all holders of the pooled objects (the tree and the analyses), so they are destroyed last.
+    buffer_pool<stdin_bits_and_types>  stdin_pool;
+    buffer_pool<cmp_operands_trace>  cmp_operands_pool;
+    input_bits  stdin_bits_buffer;
+    execution_trace  raw_trace_buffer;
+
     branching_node*  entry_branching;
-    std::unordered_set<branching_node*>  leaf_branchings;
+    branching_node_set  leaf_branchings;
+
+    execution_trace_store  execution_traces;
+    br_instr_execution_trace_store  br_instr_execution_traces;
 
-    std::unordered_set<location_id>  covered_branchings;
-    std::unordered_set<branching_location_and_direction>  uncovered_branchings;
+    coverage_state  coverage;
     std::unordered_set<location_id>  branchings_to_crashes;
 
+    loop_detection_cache  loop_detection;
     primary_coverage_target_branchings  primary_coverage_targets;
     std::unordered_map<location_id, iid_location_props>  iid_pivots;
+    std::shared_ptr<std::size_t>  iid_histograms_bytes;
 
-    std::unordered_set<branching_node*>  dead_nodes_buffer;
-    std::unordered_set<branching_node*>  coverage_failures_with_hope;
+    tree_change_events  change_events;
+    std::unordered_map<location_id, branching_node_set>  coverage_failures_with_hope;
 
     input_flow_analysis_thread  input_flow_thread;
 
+    static natural_32_bit constexpr  MEMORY_CHECK_PERIOD{ 100U }; // In driver executions.
+    std::function<void()>  rebuild_executor;
+    execution_cache*  execution_cache_ptr;
+    std::deque<input_bits>  seed_inputs;
+
     STATE  state;
     coverage_progress_control_props  coverage_control;
     bitshare_analysis  bitshare;
-    local_search_analysis  local_search;
+    std::vector<local_search_slot>  local_search_slots; // Never empty.
+    std::size_t  active_local_search_slot_index; // The slot which generated the last input.
     bitflip_analysis  bitflip;
 
     natural_32_bit  max_input_width;
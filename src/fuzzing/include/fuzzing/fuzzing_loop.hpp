@@ -1,23 +1,31 @@
 #ifndef FUZZING_FUZZING_LOOP_HPP_INCLUDED
 #   define FUZZING_FUZZING_LOOP_HPP_INCLUDED
 
+#   include <fuzzing/campaign_context.hpp>
 #   include <fuzzing/termination_info.hpp>
+#   include <fuzzing/target_metadata.hpp>
 #   include <fuzzing/analysis_outcomes.hpp>
 #   include <fuzzing/execution_record.hpp>
 #   include <fuzzing/execution_record_writer.hpp>
+#   include <fuzzing/checkpoint.hpp>
 #   include <connection/benchmark_executor.hpp>
 #   include <sala/program.hpp>
 #   include <functional>
+#   include <vector>
 
 namespace  fuzzing {
 
 
 analysis_outcomes  run(
+        campaign_context&  context,
         connection::benchmark_executor&  benchmark_executor,
         sala::Program const* sala_program_ptr,
+        target_metadata const&  metadata,
         execution_record_writer&  save_execution_record,
         std::function<void(execution_record const&)> const&  collector_of_boundary_violations,
         fuzzing::termination_info const&  info,
+        std::vector<vecu8> const&  seed_inputs,
+        checkpoint_config const&  checkpoints,
         bool  render
         );
 
@@ -0,0 +1,69 @@
+#ifndef FUZZING_INPUT_BITS_HPP_INCLUDED
+#   define FUZZING_INPUT_BITS_HPP_INCLUDED
+
+#   include <utility/math.hpp>
+#   include <utility/assumptions.hpp>
+#   include <cstddef>
+#   include <utility>
+
+namespace  fuzzing {
+
+
+// Bits of an input packed in bytes, so that the input goes to and from the stdin without
+// a conversion. The bit 'i' is the bit 'i % 8' of the byte 'i / 8', as counted by 'get_bit'
+// and 'set_bit' (i.e., in the order of 'bytes_to_bits'). Unused bits of the last byte are 0.
+// Besides the access to single bits, there are copies of ranges of bits and loads and stores
+// of values of input types (up to 8 bytes), which work with whole bytes and words.
+struct  input_bits
+{
+    input_bits() : data{}, num_bits{ 0UL } {}
+    explicit input_bits(vecu8 const&  bytes) : data{ bytes }, num_bits{ 8UL * bytes.size() } {}
+
+    std::size_t  size() const { return num_bits; }
+    bool  empty() const { return num_bits == 0UL; }
+    void  clear() { data.clear(); num_bits = 0UL; }
+    void  swap(input_bits&  other) { data.swap(other.data); std::swap(num_bits, other.num_bits); }
+
+    // Returns all the bytes; the last one may be used only partially.
+    vecu8 const&  bytes() const { return data; }
+    std::size_t  num_bytes() const { return data.size(); }
+
+    void  assign_bytes(natural_8_bit const*  begin, natural_8_bit const*  end);
+    void  assign_bytes(vecu8 const&  bytes) { assign_bytes(bytes.data(), bytes.data() + bytes.size()); }
+
+    bool  at(std::size_t const  bit_index) const
+    {
+        ASSUMPTION(bit_index < num_bits);
+        return get_bit(&data[bit_index >> 3U], (natural_8_bit)(bit_index & 7U));
+    }
+    void  set(std::size_t const  bit_index, bool const  value)
+    {
+        ASSUMPTION(bit_index < num_bits);
+        set_bit(&data[bit_index >> 3U], (natural_8_bit)(bit_index & 7U), value);
+    }
+    void  flip(std::size_t const  bit_index) { set(bit_index, !at(bit_index)); }
+    void  push_back(bool  value);
+    void  resize(std::size_t  new_num_bits); // New bits are 0.
+
+    // Copies 'count' bits of 'src' starting at 'src_begin' here, starting at 'dst_begin'.
+    // Whole bytes are copied at once, when both ranges start at a byte boundary.
+    void  copy_bits(input_bits const&  src, std::size_t  src_begin, std::size_t  dst_begin, std::size_t  count);
+
+    // The value of 'num_value_bytes' bytes starting at the byte boundary 'bit_index' in the
+    // memory layout of the value (i.e., a 'number_overlay' can be loaded this way). The store
+    // changes only the bits set in the mask.
+    natural_64_bit  load_word(std::size_t  bit_index, std::size_t  num_value_bytes) const;
+    void  store_word(std::size_t  bit_index, std::size_t  num_value_bytes, natural_64_bit  value, natural_64_bit  mask = ~0ULL);
+
+    bool  operator==(input_bits const&  other) const { return num_bits == other.num_bits && data == other.data; }
+    bool  operator!=(input_bits const&  other) const { return !(*this == other); }
+
+private:
+    vecu8  data;
+    std::size_t  num_bits;
+};
+
+
+}
+
+#endif
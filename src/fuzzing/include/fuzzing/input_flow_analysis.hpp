@@ -3,6 +3,8 @@
 
 #   include <fuzzing/execution_trace.hpp>
 #   include <fuzzing/branching_node.hpp>
+#   include <fuzzing/checkpoint.hpp>
+#   include <fuzzing/stdin_bit_set.hpp>
 #   include <iomodels/stdin_base.hpp>
 #   include <iomodels/stdout_base.hpp>
 #   include <iomodels/configuration.hpp>
@@ -28,11 +30,11 @@ struct  input_flow_analysis
     {
         // Input
         stdin_bits_and_types_pointer  input_ptr{ nullptr };
-        execution_trace_pointer  trace_ptr{ nullptr };
+        stored_execution_trace  trace{};
         trace_index_type  trace_size{ 0U };
 
         // Output
-        std::vector<std::unordered_set<stdin_bit_index> >  sensitive_bits{};
+        std::vector<stdin_bit_set>  sensitive_bits{};
     };
 
     struct  performance_statistics
@@ -55,6 +57,10 @@ struct  input_flow_analysis
 
     performance_statistics const&  get_statistics() const { return statistics; }
 
+    // Only the statistics are saved; the analysis must not run.
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+    void  load_checkpoint(checkpoint_reader&  reader);
+
 private:
 
     struct input_flow;
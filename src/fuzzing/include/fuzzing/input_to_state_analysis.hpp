@@ -0,0 +1,77 @@
+#ifndef FUZZING_INPUT_TO_STATE_ANALYSIS_HPP_INCLUDED
+#   define FUZZING_INPUT_TO_STATE_ANALYSIS_HPP_INCLUDED
+
+#   include <fuzzing/execution_trace.hpp>
+#   include <fuzzing/branching_node.hpp>
+#   include <fuzzing/checkpoint.hpp>
+#   include <utility/math.hpp>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+// Solves equality and magic-value comparisons (checksums, magic numbers, etc.) by
+// looking for the raw bytes of one operand of the comparison in the input and by
+// patching them with the other operand (and its neighbours). The operands are
+// available only for targets instrumented with the instrumenter's option 'cmp_operands'.
+struct  input_to_state_analysis
+{
+    enum  STATE
+    {
+        READY,
+        BUSY
+    };
+
+    struct  performance_statistics
+    {
+        std::size_t  generated_inputs{ 0 };
+        std::size_t  start_calls{ 0 };
+        std::size_t  start_calls_failed{ 0 };
+        std::size_t  stop_calls_success{ 0 };
+        std::size_t  stop_calls_depleted{ 0 };
+    };
+
+    input_to_state_analysis();
+
+    bool  is_ready() const { return state == READY; }
+    bool  is_busy() const { return state == BUSY; }
+
+    branching_node*  get_node() const { return node; }
+
+    // When there are no operands for the node or they do not occur in its input,
+    // the analysis does not start, i.e. it stays in the state READY.
+    void  start(branching_node*  node_ptr);
+    void  stop();
+
+    bool  generate_next_input(input_bits&  bits_ref);
+    void  process_execution_results();
+
+    performance_statistics const&  get_statistics() const { return statistics; }
+
+    // Only the data kept between runs of the analysis are saved. It is loaded to a ready analysis.
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+    void  load_checkpoint(checkpoint_reader&  reader);
+
+private:
+
+    static std::size_t constexpr  max_num_candidates{ 32UL };
+
+    void  insert_candidates(
+            vecu8 const&  bytes,
+            natural_64_bit  searched_value,
+            natural_64_bit  patch_value,
+            natural_8_bit  num_bytes
+            );
+
+    STATE  state;
+    branching_node*  node;
+    std::vector<vecu8>  candidates;
+    std::size_t  next_candidate_index;
+
+    performance_statistics  statistics;
+};
+
+
+}
+
+#endif
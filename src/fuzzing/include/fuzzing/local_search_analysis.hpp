@@ -3,6 +3,8 @@
 
 #   include <fuzzing/execution_trace.hpp>
 #   include <fuzzing/branching_node.hpp>
+#   include <fuzzing/checkpoint.hpp>
+#   include <fuzzing/progress_recorder.hpp>
 #   include <fuzzing/number_overlay.hpp>
 #   include <utility/math.hpp>
 #   include <utility/random.hpp>
@@ -34,6 +36,7 @@ struct  local_search_analysis
     {
         natural_32_bit  input_start_bit_index;
         std::vector<natural_8_bit>  value_bit_indices;
+        natural_64_bit  value_bits_mask; // The bits of 'value_bit_indices' in the memory of the value.
     };
 
     struct  full_path_record
@@ -150,7 +153,7 @@ struct  local_search_analysis
         std::size_t  stop_calls_failed{ 0 };
     };
 
-    local_search_analysis();
+    local_search_analysis(progress_recorder&  recorder_, natural_32_bit  random_seed);
 
     bool  is_ready() const { return state == READY; }
     bool  is_busy() const { return state == BUSY; }
@@ -161,14 +164,18 @@ struct  local_search_analysis
 
     natural_32_bit  max_num_executions() const { return max_executions; }
 
-    bool  generate_next_input(vecb&  bits_ref);
-    void  process_execution_results(execution_trace_pointer  trace_ptr, stdin_bits_and_types_pointer  bits_and_types_ptr);
+    bool  generate_next_input(input_bits&  bits_ref);
+    void  process_execution_results(stored_execution_trace const&  trace, stdin_bits_and_types_pointer  bits_and_types_ptr);
 
     branching_node*  get_node() const { return node; }
     bool  get_stopped_early() const { return stopped_early; }
 
     performance_statistics const&  get_statistics() const { return statistics; }
 
+    // Only the data kept between runs of the analysis are saved. It is loaded to a ready analysis.
+    void  save_checkpoint(checkpoint_writer&  writer) const;
+    void  load_checkpoint(checkpoint_reader&  reader);
+
 private:
 
     void  compute_shifts_of_next_partial();
@@ -232,8 +239,8 @@ private:
             );
     bool  is_improving_value(float_64_bit  value) const;
     void  commit_execution_results(stdin_bits_and_types_pointer  bits_and_types_ptr, vecf64 const&  values);
-    void  bits_to_point(vecb const&  bits, vecf64&  point);
-    vector_overlay  point_to_bits(vecf64 const&  point, vecb&  bits);
+    void  bits_to_point(input_bits const&  bits, vecf64&  point);
+    vector_overlay  point_to_bits(vecf64 const&  point, input_bits&  bits);
 
     STATE  state;
     branching_node*  node;
@@ -261,6 +268,7 @@ private:
     random_generator_for_natural_64_bit  rnd_generator;
 
     performance_statistics  statistics;
+    progress_recorder&  recorder;
 };
 
 
@@ -0,0 +1,43 @@
+#ifndef FUZZING_LOCATION_ID_MAP_HPP_INCLUDED
+#   define FUZZING_LOCATION_ID_MAP_HPP_INCLUDED
+
+#   include <fuzzing/instrumentation_types.hpp>
+#   include <algorithm>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+// Per-location data in a flat array indexed directly by 'location_id::id_type' (no hashing).
+// The instrumenter assigns the ids densely, so the array is sized once from 'target_metadata'.
+// For targets without the metadata the array grows on demand.
+template<typename T>
+struct  location_id_map
+{
+    using  id_type = location_id::id_type;
+
+    explicit location_id_map(std::size_t const  num_ids = 0U) : values(num_ids + 1U) {}
+
+    void  reserve_ids(std::size_t const  num_ids) { if (num_ids + 1U > values.size()) values.resize(num_ids + 1U); }
+
+    T&  operator[](id_type const  id)
+    {
+        if (id >= values.size())
+            values.resize(std::max((std::size_t)id + 1U, 2U * values.size()));
+        return values[id];
+    }
+
+    // Returns nullptr for an id outside the array; otherwise the (possibly default) stored value.
+    T*  find(id_type const  id) { return id < values.size() ? &values[id] : nullptr; }
+    T const*  find(id_type const  id) const { return id < values.size() ? &values[id] : nullptr; }
+
+    std::size_t  num_slots() const { return values.size(); }
+
+private:
+    std::vector<T>  values;
+};
+
+
+}
+
+#endif
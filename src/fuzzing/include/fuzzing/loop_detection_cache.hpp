@@ -0,0 +1,75 @@
+#ifndef FUZZING_LOOP_DETECTION_CACHE_HPP_INCLUDED
+#   define FUZZING_LOOP_DETECTION_CACHE_HPP_INCLUDED
+
+#   include <fuzzing/branching_node.hpp>
+#   include <utility/basic_numeric_types.hpp>
+#   include <cstddef>
+#   include <memory>
+#   include <unordered_map>
+#   include <unordered_set>
+
+namespace  fuzzing {
+
+
+// Caches loop heads and bodies detected along paths from the root of the tree to nodes.
+// The result for a path is the same as from 'fuzzer::detect_loops_along_path_to_node',
+// i.e. the path is explored backwards from the end node (because of do-while loops).
+//
+// Let 'node' be the end node and 'prev' its previous occurrence (the nearest node with
+// the same location on the path). The backward exploration from 'node' collapses
+// its stack to 'node' only, when it reaches 'prev', and from there on it proceeds
+// exactly as the exploration from 'prev'. So, the result for 'node' is the result for
+// 'prev' extended by loops detected between 'node' and 'prev'. When there is no 'prev',
+// the result is the same as for the predecessor of 'node'. Therefore, a query walks only
+// the nodes between 'node' and 'prev', provided the result for 'prev' is cached.
+//
+// The results form chains of extensions sharing their tails; a chain is compacted to
+// a single map once it gets longer than 'MAX_CHAIN_LENGTH'.
+struct  loop_detection_cache
+{
+    using  loop_heads_to_bodies_map = std::unordered_map<location_id, std::unordered_set<location_id> >;
+
+    struct  performance_statistics
+    {
+        std::size_t  queries{ 0 };
+        std::size_t  summaries_computed{ 0 };
+        std::size_t  summaries_compacted{ 0 };
+        std::size_t  nodes_walked{ 0 };
+    };
+
+    loop_detection_cache();
+
+    void  compute_loop_heads_to_bodies(branching_node*  end_node, loop_heads_to_bodies_map&  loop_heads_to_bodies);
+
+    // Must be called for each node before it is deleted.
+    void  erase(branching_node*  node) { summaries.erase(node); }
+    void  clear() { summaries.clear(); }
+
+    std::size_t  size() const { return summaries.size(); }
+    performance_statistics const&  get_statistics() const { return statistics; }
+
+private:
+
+    static natural_32_bit constexpr  MAX_CHAIN_LENGTH{ 32U };
+
+    struct  summary
+    {
+        std::shared_ptr<summary const>  base;
+        loop_heads_to_bodies_map  loop_heads_to_bodies;
+        natural_32_bit  chain_length;
+    };
+
+    using  summary_pointer = std::shared_ptr<summary const>;
+
+    summary_pointer  get_summary(branching_node*  node);
+    summary_pointer  compute_summary(branching_node*  node);
+
+    std::unordered_map<branching_node*, summary_pointer>  summaries;
+    summary_pointer  empty_summary;
+    performance_statistics  statistics;
+};
+
+
+}
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef FUZZING_OBJECT_POOL_HPP_INCLUDED
+#   define FUZZING_OBJECT_POOL_HPP_INCLUDED
+
+#   include <utility/basic_numeric_types.hpp>
+#   include <utility/assumptions.hpp>
+#   include <cstddef>
+#   include <memory>
+#   include <mutex>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+struct  object_pool_statistics
+{
+    std::size_t  num_slabs{ 0 };
+    std::size_t  num_live_objects{ 0 };
+    std::size_t  max_live_objects{ 0 };
+    std::size_t  live_bytes{ 0 };
+    std::size_t  reserved_bytes{ 0 };
+    // The ratio of reserved slots which are not used by any live object.
+    float_64_bit  fragmentation{ 0.0 };
+};
+
+
+// A slab allocator of raw memory for objects of the type T. Slots of released objects
+// are kept in a free list and reused; slabs are released only with the pool itself.
+// So, the pool trades the memory of released slots for allocations without a call
+// to the general-purpose heap and for objects packed densely in memory.
+//
+// The pools are shared by all campaigns of the process (objects may also be released by
+// other threads than the one which allocated them), so all operations take a lock.
+template<typename T, std::size_t  NUM_SLOTS_PER_SLAB = 4096UL>
+struct  object_pool
+{
+    static_assert(NUM_SLOTS_PER_SLAB > 0UL);
+
+    object_pool()
+        : slabs{}
+        , free_list{ nullptr }
+        , num_used_slots_in_last_slab{ NUM_SLOTS_PER_SLAB }
+        , num_live_objects{ 0UL }
+        , max_live_objects{ 0UL }
+        , mutex{}
+    {}
+
+    object_pool(object_pool const&) = delete;
+    object_pool&  operator=(object_pool const&) = delete;
+
+    void*  allocate()
+    {
+        std::lock_guard<std::mutex> const  lock(mutex);
+        slot*  ptr;
+        if (free_list != nullptr)
+        {
+            ptr = free_list;
+            free_list = free_list->next;
+        }
+        else
+        {
+            if (num_used_slots_in_last_slab == NUM_SLOTS_PER_SLAB)
+            {
+                slabs.push_back(std::make_unique<slot[]>(NUM_SLOTS_PER_SLAB));
+                num_used_slots_in_last_slab = 0UL;
+            }
+            ptr = &slabs.back()[num_used_slots_in_last_slab];
+            ++num_used_slots_in_last_slab;
+        }
+        ++num_live_objects;
+        if (max_live_objects < num_live_objects)
+            max_live_objects = num_live_objects;
+        return ptr->storage;
+    }
+
+    void  deallocate(void* const  ptr)
+    {
+        std::lock_guard<std::mutex> const  lock(mutex);
+        ASSUMPTION(ptr != nullptr && num_live_objects > 0UL);
+        slot* const  s = static_cast<slot*>(ptr);
+        s->next = free_list;
+        free_list = s;
+        --num_live_objects;
+    }
+
+    static constexpr std::size_t  get_slot_bytes() { return sizeof(slot); }
+
+    // Summed over all campaigns of the process.
+    object_pool_statistics  get_statistics() const
+    {
+        std::lock_guard<std::mutex> const  lock(mutex);
+        object_pool_statistics  stats;
+        stats.num_slabs = slabs.size();
+        stats.num_live_objects = num_live_objects;
+        stats.max_live_objects = max_live_objects;
+        stats.live_bytes = num_live_objects * sizeof(slot);
+        stats.reserved_bytes = slabs.size() * NUM_SLOTS_PER_SLAB * sizeof(slot);
+        stats.fragmentation = stats.reserved_bytes == 0UL ? 0.0 :
+                1.0 - (float_64_bit)stats.live_bytes / (float_64_bit)stats.reserved_bytes;
+        return stats;
+    }
+
+private:
+
+    union  slot
+    {
+        slot*  next;
+        alignas(T) unsigned char  storage[sizeof(T)];
+    };
+
+    std::vector<std::unique_ptr<slot[]> >  slabs;
+    slot*  free_list;
+    std::size_t  num_used_slots_in_last_slab;
+    std::size_t  num_live_objects;
+    std::size_t  max_live_objects;
+    mutable std::mutex  mutex;
+};
+
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef FUZZING_OPTIMIZER_HPP_INCLUDED
 #   define FUZZING_OPTIMIZER_HPP_INCLUDED
 
+#   include <fuzzing/campaign_context.hpp>
 #   include <fuzzing/execution_record.hpp>
 #   include <fuzzing/execution_record_writer.hpp>
 #   include <fuzzing/instrumentation_types.hpp>
@@ -41,7 +42,7 @@ struct  optimizer final
         natural_32_bit  num_extended_tests{ 0 };
     };
 
-    optimizer(configuration const&  cfg);
+    optimizer(campaign_context&  context_, configuration const&  cfg);
 
     float_64_bit  num_remaining_seconds() const { return (float_64_bit)config.max_seconds - get_elapsed_seconds(); }
     float_64_bit  get_elapsed_seconds() const { return std::chrono::duration<float_64_bit>(time_point_current - time_point_start).count(); }
@@ -58,6 +59,7 @@ struct  optimizer final
 
 private:
 
+    campaign_context&  context;
     configuration  config;
 
     std::chrono::steady_clock::time_point  time_point_start;
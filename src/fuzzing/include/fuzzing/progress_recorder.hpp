@@ -2,6 +2,7 @@
 #   define FUZZING_PROGRESS_RECORDER_HPP_INCLUDED
 
 #   include <fuzzing/branching_node.hpp>
+#   include <iomodels/iomanager.hpp>
 #   include <utility/basic_numeric_types.hpp>
 #   include <unordered_set>
 #   include <string>
@@ -30,7 +31,12 @@ struct  progress_recorder
         FAILED      = 4
     };
 
-    static progress_recorder& instance();
+    explicit progress_recorder(iomodels::iomanager const&  io_);
+
+    progress_recorder(progress_recorder const&) = delete;
+    progress_recorder(progress_recorder&&) = delete;
+    progress_recorder& operator=(progress_recorder const&) const = delete;
+    progress_recorder& operator=(progress_recorder&&) const = delete;
 
     void  start(std::filesystem::path const&  path_to_client_, std::filesystem::path const&  output_dir_);
     void  stop();
@@ -147,13 +153,6 @@ private:
         std::unordered_set<branching_node::guid_type>  closed_node_guids;
     };
 
-    progress_recorder();
-
-    progress_recorder(progress_recorder const&) = delete;
-    progress_recorder(progress_recorder&&) = delete;
-    progress_recorder& operator=(progress_recorder const&) const = delete;
-    progress_recorder& operator=(progress_recorder&&) const = delete;
-
     void  on_analysis_start(ANALYSIS analysis_, analysis_common_info&  info, branching_node const*  node_ptr);
     void  on_analysis_stop();
 
@@ -161,6 +160,8 @@ private:
 
     static std::string const&  analysis_name(ANALYSIS a);
 
+    iomodels::iomanager const&  io;
+
     bool  started;
 
     std::filesystem::path  output_dir;
@@ -182,9 +183,6 @@ private:
 };
 
 
-inline progress_recorder&  recorder() { return progress_recorder::instance(); }
-
-
 }
 
 #endif
@@ -0,0 +1,28 @@
+#ifndef FUZZING_SEED_CORPUS_HPP_INCLUDED
+#   define FUZZING_SEED_CORPUS_HPP_INCLUDED
+
+#   include <utility/math.hpp>
+#   include <filesystem>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+// Inputs of tests generated by previous runs of fuzzing (or by other tools). They are used
+// to warm-start fuzzing: the fuzzer executes them right after the startup input, before any
+// analysis, so the tree and the coverage are built from them.
+
+// Both functions return false (and leave 'stdin_bytes' untouched), when the file is not a test
+// or it is malformed. Inputs of a Test-Comp test without the type are read as 'int'.
+bool  load_native_test_input(std::filesystem::path const&  pathname, vecu8&  stdin_bytes);
+bool  load_testcomp_test_input(std::filesystem::path const&  pathname, vecu8&  stdin_bytes);
+
+// Collects inputs of all native ('*.json') and Test-Comp ('*.xml') tests in the directory and
+// its subdirectories, in the order of paths and without duplicates. Returns the number of files
+// which were not loaded (e.g. configurations, outcomes, or metadata of test suites).
+std::size_t  load_seed_inputs(std::filesystem::path const&  seed_dir, std::vector<vecu8>&  inputs);
+
+
+}
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef FUZZING_STDIN_BIT_SET_HPP_INCLUDED
+#   define FUZZING_STDIN_BIT_SET_HPP_INCLUDED
+
+#   include <fuzzing/stdin_bits.hpp>
+#   include <cstddef>
+#   include <iterator>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+// A set of indices of stdin bits stored as a sorted vector of disjoint, non-adjacent
+// ranges. Sensitive bits come in whole bytes (or whole values), so the number of
+// ranges is typically much smaller than the number of bits. Iteration visits bit
+// indices in the increasing order; union and intersection test are linear in the
+// number of ranges.
+struct  stdin_bit_set
+{
+    struct  range
+    {
+        stdin_bit_index  begin;
+        stdin_bit_index  end; // One past the last bit of the range.
+    };
+
+    struct  const_iterator
+    {
+        using  iterator_category = std::forward_iterator_tag;
+        using  value_type = stdin_bit_index;
+        using  difference_type = std::ptrdiff_t;
+        using  pointer = stdin_bit_index const*;
+        using  reference = stdin_bit_index;
+
+        const_iterator() : range_ptr{ nullptr }, range_end_ptr{ nullptr }, idx{ 0U } {}
+        const_iterator(range const*  range_ptr_, range const*  range_end_ptr_)
+            : range_ptr{ range_ptr_ }, range_end_ptr{ range_end_ptr_ }, idx{ range_ptr_ == range_end_ptr_ ? 0U : range_ptr_->begin }
+        {}
+
+        reference  operator*() const { return idx; }
+        const_iterator&  operator++()
+        {
+            if (++idx == range_ptr->end)
+            {
+                ++range_ptr;
+                idx = range_ptr == range_end_ptr ? 0U : range_ptr->begin;
+            }
+            return *this;
+        }
+        const_iterator  operator++(int) { const_iterator  old{ *this }; ++*this; return old; }
+
+        bool  operator==(const_iterator const&  other) const { return range_ptr == other.range_ptr && idx == other.idx; }
+        bool  operator!=(const_iterator const&  other) const { return !(*this == other); }
+
+    private:
+        range const*  range_ptr;
+        range const*  range_end_ptr;
+        stdin_bit_index  idx;
+    };
+
+    stdin_bit_set() : ranges_{}, num_bits{ 0UL } {}
+
+    bool  empty() const { return num_bits == 0UL; }
+    std::size_t  size() const { return num_bits; }
+    void  clear() { ranges_.clear(); num_bits = 0UL; }
+
+    std::vector<range> const&  ranges() const { return ranges_; }
+
+    const_iterator  begin() const { return { ranges_.data(), ranges_.data() + ranges_.size() }; }
+    const_iterator  end() const { return { ranges_.data() + ranges_.size(), ranges_.data() + ranges_.size() }; }
+
+    bool  contains(stdin_bit_index  idx) const;
+    bool  intersects(stdin_bit_set const&  other) const;
+
+    // The methods below return true, if any new bit was inserted.
+    bool  insert(stdin_bit_index const  idx) { return insert(idx, idx + 1U); }
+    bool  insert(stdin_bit_index  begin, stdin_bit_index  end);
+    bool  unite(stdin_bit_set const&  other);
+
+private:
+    std::vector<range>  ranges_;
+    std::size_t  num_bits;
+};
+
+
+}
+
+#endif
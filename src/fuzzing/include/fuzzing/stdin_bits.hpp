@@ -1,6 +1,7 @@
 #ifndef FUZZING_STDIN_BITS_HPP_INCLUDED
 #   define FUZZING_STDIN_BITS_HPP_INCLUDED
 
+#   include <fuzzing/input_bits.hpp>
 #   include <iomodels/stdin_base.hpp>
 #   include <utility/math.hpp>
 #   include <memory>
@@ -14,8 +15,13 @@ struct  stdin_bits_and_types
     using  type_of_input_bits = iomodels::stdin_base::type_of_input_bits;
     using  vect = iomodels::stdin_base::input_types_vector;
 
+    stdin_bits_and_types() = default;
     stdin_bits_and_types(vecu8 const&  bytes_, vect const&  types_);
 
+    // Reuses the capacity of the vectors, so that recycled instances (see 'buffer_pool') do not allocate.
+    void  assign(vecu8 const&  bytes_, vect const&  types_);
+    void  clear();
+
     natural_32_bit  type_index(natural_32_bit  bit_index) const;
     natural_32_bit  type_start_bit_index(natural_32_bit const  type_index) const
     { return type_end_bit_index(type_index) + 1U - num_bits(types.at(type_index)); }
@@ -23,7 +29,7 @@ struct  stdin_bits_and_types
 
     type_of_input_bits  type_of_bit(natural_32_bit const  bit_index) const { return types.at(type_index(bit_index)); }
 
-    vecb  bits;
+    input_bits  bits;
     vect  types;
     vecu32  bit_end_indices_of_types;
 };
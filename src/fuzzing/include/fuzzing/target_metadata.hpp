@@ -0,0 +1,28 @@
+#ifndef FUZZING_TARGET_METADATA_HPP_INCLUDED
+#   define FUZZING_TARGET_METADATA_HPP_INCLUDED
+
+#   include <utility/basic_numeric_types.hpp>
+#   include <filesystem>
+
+namespace  fuzzing {
+
+
+// Sizes of the location id spaces of the target, as written by the instrumenter
+// to '<program>_metadata.json'. The ids are dense: 1, ..., num_*. Zero means unknown.
+struct  target_metadata
+{
+    natural_32_bit  num_cond_locations{ 0 };
+    natural_32_bit  num_br_locations{ 0 };
+    natural_32_bit  num_call_sites{ 0 };
+    // Zero also for files written before the field was introduced; no operands are then passed.
+    natural_32_bit  num_cmp_operands_sites{ 0 };
+};
+
+
+// Returns false (and leaves 'metadata' untouched), when the file does not exist or it is malformed.
+bool  load_target_metadata(std::filesystem::path const&  pathname, target_metadata&  metadata);
+
+
+}
+
+#endif
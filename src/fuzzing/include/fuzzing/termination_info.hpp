@@ -10,6 +10,20 @@ struct termination_info
 {
     natural_32_bit  max_executions{ 1000000 };
     natural_32_bit  max_seconds{ 900 }; // 15min
+    natural_32_bit  max_server_megabytes{ 0 }; // No limit, when 0.
+    // When set, also payloads which cannot be rebuilt by re-execution (e.g. bitshare samples)
+    // may be evicted to meet 'max_server_megabytes'. Then coverage results may differ.
+    bool  lossy_eviction{ false };
+    // Max memory of results of executions kept for inputs generated again (see 'execution_cache').
+    natural_32_bit  execution_cache_megabytes{ 64 }; // No cache, when 0.
+    // Max number of local searches running at once, each on a different node (see 'fuzzer::local_search_slot').
+    natural_32_bit  max_local_searches{ 1 };
+    // The seed of the random generators of the fuzzer.
+    natural_32_bit  random_seed{ 1 };
+    // When set, decisions depending on the elapsed time or on timing of threads are replaced by
+    // ones depending on the number of executions. Then runs with the same 'max_executions' produce
+    // the same tests (unless stopped by 'max_seconds' or by a time out of the input flow analysis).
+    bool  deterministic{ false };
 };
 
 
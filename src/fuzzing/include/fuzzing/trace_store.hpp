@@ -0,0 +1,175 @@
+#ifndef FUZZING_TRACE_STORE_HPP_INCLUDED
+#   define FUZZING_TRACE_STORE_HPP_INCLUDED
+
+#   include <fuzzing/execution_trace.hpp>
+#   include <utility/assumptions.hpp>
+#   include <utility/hash_combine.hpp>
+#   include <algorithm>
+#   include <atomic>
+#   include <cstddef>
+#   include <memory>
+#   include <unordered_map>
+#   include <vector>
+
+namespace  fuzzing {
+
+
+struct  trace_store_statistics
+{
+    std::size_t  chunks_created{ 0 };
+    std::size_t  chunks_shared{ 0 };
+    std::size_t  indexed_chunks{ 0 };
+    // Memory of chunks referenced by at least one handle.
+    std::size_t  live_bytes{ 0 };
+};
+
+
+// Stores traces as sequences of immutable fixed-size chunks of records. Equal chunks
+// are stored only once, so traces of executions following the same path (i.e. traces
+// of sibling nodes before their divergence point, or repeated iterations of a loop)
+// share memory. A stored trace is referenced by a cheap to copy handle, which provides
+// random access by 'trace_index_type'. Since chunks are immutable, handles may be read
+// from other threads; only the insertion must be done from the thread owning the store.
+template<typename  record_type, std::size_t  NUM_RECORDS_PER_CHUNK = 32UL>
+struct  trace_store
+{
+    static_assert(NUM_RECORDS_PER_CHUNK > 0UL);
+
+    struct  chunk
+    {
+        std::vector<record_type>  records;
+        natural_64_bit  hash;
+    };
+
+    using  chunk_pointer = std::shared_ptr<chunk const>;
+
+    struct  handle
+    {
+        handle() : chunks{ nullptr }, num_records{ 0UL } {}
+
+        bool  empty() const { return num_records == 0UL; }
+        std::size_t  size() const { return num_records; }
+
+        record_type const&  at(std::size_t const  idx) const
+        {
+            ASSUMPTION(idx < num_records);
+            return chunks->at(idx / NUM_RECORDS_PER_CHUNK)->records.at(idx % NUM_RECORDS_PER_CHUNK);
+        }
+        record_type const&  front() const { return at(0UL); }
+        record_type const&  back() const { return at(num_records - 1UL); }
+
+    private:
+        friend struct  trace_store;
+
+        std::shared_ptr<std::vector<chunk_pointer> const>  chunks;
+        std::size_t  num_records;
+    };
+
+    trace_store()
+        : index{}
+        , min_index_size_to_sweep{ 1024UL }
+        , live_bytes{ std::make_shared<std::atomic<std::size_t> >(0UL) }
+        , statistics{}
+    {}
+
+    trace_store(trace_store const&) = delete;
+    trace_store&  operator=(trace_store const&) = delete;
+
+    handle  insert(std::vector<record_type> const&  records)
+    {
+        handle  result;
+        if (records.empty())
+            return result;
+
+        auto  chunks = std::make_shared<std::vector<chunk_pointer> >();
+        chunks->reserve((records.size() + NUM_RECORDS_PER_CHUNK - 1UL) / NUM_RECORDS_PER_CHUNK);
+        for (auto  it = records.begin(); it != records.end(); )
+        {
+            auto const  it_end = std::next(it, std::min((std::size_t)std::distance(it, records.end()), NUM_RECORDS_PER_CHUNK));
+            chunks->push_back(insert_chunk(it, it_end));
+            it = it_end;
+        }
+
+        if (index.size() >= min_index_size_to_sweep)
+            sweep();
+
+        result.chunks = std::move(chunks);
+        result.num_records = records.size();
+        return result;
+    }
+
+    trace_store_statistics  get_statistics() const
+    {
+        trace_store_statistics  result{ statistics };
+        result.live_bytes = live_bytes->load(std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+
+    using  record_iterator = typename std::vector<record_type>::const_iterator;
+
+    chunk_pointer  insert_chunk(record_iterator const  begin, record_iterator const  end)
+    {
+        natural_64_bit  hash{ 0UL };
+        for (auto  it = begin; it != end; ++it)
+            hash_combine(hash, compute_hash(*it));
+
+        auto const  range = index.equal_range(hash);
+        for (auto  it = range.first; it != range.second; ++it)
+        {
+            chunk_pointer const  ptr{ it->second.lock() };
+            if (ptr != nullptr && std::equal(begin, end, ptr->records.begin(), ptr->records.end(),
+                    [](record_type const&  l, record_type const&  r) { return is_same_record(l, r); }))
+            {
+                ++statistics.chunks_shared;
+                return ptr;
+            }
+        }
+
+        // Chunks may outlive the store (and they may be released from other threads),
+        // so they share the counter of live bytes with the store.
+        std::size_t const  num_bytes{ sizeof(chunk) + (std::size_t)std::distance(begin, end) * sizeof(record_type) };
+        live_bytes->fetch_add(num_bytes, std::memory_order_relaxed);
+        chunk_pointer const  ptr{
+                new chunk{ { begin, end }, hash },
+                [counter = live_bytes, num_bytes](chunk const* const  p) {
+                        counter->fetch_sub(num_bytes, std::memory_order_relaxed);
+                        delete p;
+                        }
+                };
+        index.insert({ hash, ptr });
+        ++statistics.chunks_created;
+        statistics.indexed_chunks = index.size();
+        return ptr;
+    }
+
+    // Drops index entries of chunks which are not referenced by any handle anymore.
+    void  sweep()
+    {
+        for (auto  it = index.begin(); it != index.end(); )
+            if (it->second.expired())
+                it = index.erase(it);
+            else
+                ++it;
+        min_index_size_to_sweep = std::max<std::size_t>(1024UL, 2UL * index.size());
+        statistics.indexed_chunks = index.size();
+    }
+
+    std::unordered_multimap<natural_64_bit, std::weak_ptr<chunk const> >  index;
+    std::size_t  min_index_size_to_sweep;
+    std::shared_ptr<std::atomic<std::size_t> >  live_bytes;
+    trace_store_statistics  statistics;
+};
+
+
+using  execution_trace_store = trace_store<branching_coverage_info>;
+using  stored_execution_trace = execution_trace_store::handle;
+
+using  br_instr_execution_trace_store = trace_store<br_instr_coverage_info>;
+using  stored_br_instr_execution_trace = br_instr_execution_trace_store::handle;
+
+
+}
+
+#endif
@@ -1,13 +1,13 @@
 #include <fuzzing/bitflip_analysis.hpp>
-#include <fuzzing/progress_recorder.hpp>
 #include <utility/assumptions.hpp>
 #include <utility/invariants.hpp>
 #include <utility/timeprof.hpp>
+#include <cstring>
 
 namespace  fuzzing {
 
 
-bitflip_analysis::bitflip_analysis()
+bitflip_analysis::bitflip_analysis(progress_recorder&  recorder_, natural_32_bit const  random_seed)
     : state{ READY }
     , node_ptr{ nullptr }
     , bits_and_types{ nullptr }
@@ -17,8 +17,9 @@ bitflip_analysis::bitflip_analysis()
     , probed_bit_start_index{ 0U }
     , probed_bit_end_index{ 0U }
     , processed_inputs{ nullptr }
-    , rnd_generator{}
+    , rnd_generator{ random_seed }
     , statistics{}
+    , recorder{ recorder_ }
 {}
 
 
@@ -35,7 +36,7 @@ bool  bitflip_analysis::is_mutated_type_index_valid() const
 }
 
 
-void  bitflip_analysis::start(std::unordered_set<branching_node*> const&  leaf_branchings)
+void  bitflip_analysis::start(branching_node_set const&  leaf_branchings)
 {
     ASSUMPTION(is_ready());
     ASSUMPTION(!leaf_branchings.empty());
@@ -75,7 +76,7 @@ void  bitflip_analysis::start(std::unordered_set<branching_node*> const&  leaf_b
     ++statistics.start_calls;
     statistics.max_bits = std::max(statistics.max_bits, bits_and_types->bits.size());
 
-    recorder().on_bitflip_start(node_ptr, progress_recorder::START::REGULAR);
+    recorder.on_bitflip_start(node_ptr, progress_recorder::START::REGULAR);
 }
 
 
@@ -86,11 +87,44 @@ void  bitflip_analysis::stop()
 
     state = READY;
 
-    recorder().on_bitflip_stop(progress_recorder::STOP::REGULAR);
+    recorder.on_bitflip_stop(progress_recorder::STOP::REGULAR);
 }
 
 
-bool  bitflip_analysis::generate_next_input(vecb&  bits_ref)
+void  bitflip_analysis::save_checkpoint(checkpoint_writer&  writer) const
+{
+    writer.write(statistics);
+    writer.write_random_generator(rnd_generator);
+
+    // Only inputs still referenced from the tree are saved; the others cannot be selected anyway.
+    std::vector<stdin_bits_and_types const*>  inputs;
+    for (stdin_bits_and_types const* const  input : processed_inputs)
+        if (writer.is_input_written(input))
+            inputs.push_back(input);
+    writer.write((natural_64_bit)inputs.size());
+    for (stdin_bits_and_types const* const  input : inputs)
+        writer.write_input(input);
+}
+
+
+void  bitflip_analysis::load_checkpoint(checkpoint_reader&  reader)
+{
+    ASSUMPTION(is_ready());
+
+    reader.read(statistics);
+    reader.read_random_generator(rnd_generator);
+
+    processed_inputs.clear();
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+    {
+        stdin_bits_and_types_pointer const  input{ reader.read_input() };
+        reader.check(input != nullptr);
+        processed_inputs.insert(input.get());
+    }
+}
+
+
+bool  bitflip_analysis::generate_next_input(input_bits&  bits_ref)
 {
     TMPROF_BLOCK();
 
@@ -100,7 +134,7 @@ bool  bitflip_analysis::generate_next_input(vecb&  bits_ref)
     if (is_mutated_bit_index_valid())
     {
         bits_ref = bits_and_types->bits;
-        bits_ref.at(mutated_bit_index) = !bits_ref.at(mutated_bit_index);
+        bits_ref.flip(mutated_bit_index);
 
         probed_bit_start_index = 8 * (mutated_bit_index / 8);
         probed_bit_end_index = probed_bit_start_index + 8;
@@ -120,7 +154,7 @@ bool  bitflip_analysis::generate_next_input(vecb&  bits_ref)
 
 
 template<typename T, int N>
-bool  bitflip_analysis::write_bits(vecb&  bits_ref, T const  (&values)[N])
+bool  bitflip_analysis::write_bits(input_bits&  bits_ref, T const  (&values)[N])
 {
     if (mutated_value_index >= N)
     {
@@ -131,19 +165,18 @@ bool  bitflip_analysis::write_bits(vecb&  bits_ref, T const  (&values)[N])
     probed_bit_start_index = bits_and_types->type_start_bit_index(mutated_type_index);
     probed_bit_end_index = probed_bit_start_index + 8 * sizeof(T);
 
-    vecb  bits;
-    natural_8_bit const* const  value_ptr = (natural_8_bit const*)&values[mutated_value_index];
-    bytes_to_bits(value_ptr, value_ptr + sizeof(T), bits);
+    natural_64_bit  value{ 0ULL };
+    std::memcpy(&value, &values[mutated_value_index], sizeof(T));
 
     bits_ref = bits_and_types->bits;
-    std::copy(bits.begin(), bits.end(), std::next(bits_ref.begin(), probed_bit_start_index));
+    bits_ref.store_word(probed_bit_start_index, sizeof(T), value);
 
     ++mutated_value_index;
     return true;
 }
 
 
-bool  bitflip_analysis::generate_next_typed_value(vecb&  bits_ref)
+bool  bitflip_analysis::generate_next_typed_value(input_bits&  bits_ref)
 {
     for ( ; is_mutated_type_index_valid(); ++mutated_type_index)
         switch (bits_and_types->types.at(mutated_type_index))
@@ -1,19 +1,22 @@
 #include <fuzzing/bitshare_analysis.hpp>
-#include <fuzzing/progress_recorder.hpp>
 #include <utility/assumptions.hpp>
 #include <utility/invariants.hpp>
 #include <utility/timeprof.hpp>
+#include <algorithm>
 
 namespace  fuzzing {
 
 
-bitshare_analysis::bitshare_analysis()
+bitshare_analysis::bitshare_analysis(natural_32_bit const  num_locations, progress_recorder&  recorder_)
     : state{ READY }
-    , cache{}
+    , cache{ num_locations }
+    , num_cached_locations{ 0 }
+    , samples_bytes{ 0 }
     , processed_node{ nullptr }
     , samples_ptr{ nullptr }
     , sample_index{ 0 }
     , statistics{}
+    , recorder{ recorder_ }
 {}
 
 void  bitshare_analysis::start(branching_node*  node_ptr, natural_32_bit const  execution_id_)
@@ -27,15 +30,15 @@ void  bitshare_analysis::start(branching_node*  node_ptr, natural_32_bit const
     sample_index = 0;
     execution_id = execution_id_;
 
-    auto const  cache_it = cache.find(processed_node->get_location_id().id);
-    if (cache_it != cache.end())
+    auto const  cache_ptr = cache.find(processed_node->get_location_id().id);
+    if (cache_ptr != nullptr && *cache_ptr != nullptr)
     {
         if (processed_node->successor(false).pointer == nullptr)
-            samples_ptr = &cache_it->second.front();
+            samples_ptr = &(*cache_ptr)->front();
         else
         {
             ASSUMPTION(processed_node->successor(true).pointer == nullptr);
-            samples_ptr = &cache_it->second.back();
+            samples_ptr = &(*cache_ptr)->back();
         }
         if (samples_ptr->empty())
             samples_ptr = nullptr;
@@ -43,7 +46,7 @@ void  bitshare_analysis::start(branching_node*  node_ptr, natural_32_bit const
 
     ++statistics.start_calls;
 
-    recorder().on_bitshare_start(processed_node, progress_recorder::START::REGULAR);
+    recorder.on_bitshare_start(processed_node, progress_recorder::START::REGULAR);
 }
 
 
@@ -54,17 +57,17 @@ void  bitshare_analysis::stop()
 
     if (samples_ptr == nullptr)
     {
-        recorder().on_bitshare_stop(progress_recorder::STOP::INSTANT);
+        recorder.on_bitshare_stop(progress_recorder::STOP::INSTANT);
         ++statistics.stop_calls_instant;
     }
     else if (sample_index <= samples_ptr->size())
     {
-        recorder().on_bitshare_stop(progress_recorder::STOP::EARLY);
+        recorder.on_bitshare_stop(progress_recorder::STOP::EARLY);
         ++statistics.stop_calls_early;
     }
     else
     {
-        recorder().on_bitshare_stop(progress_recorder::STOP::REGULAR);
+        recorder.on_bitshare_stop(progress_recorder::STOP::REGULAR);
         ++statistics.stop_calls_regular;
     }
 
@@ -74,7 +77,51 @@ void  bitshare_analysis::stop()
 }
 
 
-bool  bitshare_analysis::generate_next_input(vecb&  bits_ref)
+void  bitshare_analysis::save_checkpoint(checkpoint_writer&  writer) const
+{
+    writer.write(statistics);
+
+    writer.write((natural_64_bit)num_cached_locations);
+    for (std::size_t  i = 0UL; i != cache.num_slots(); ++i)
+    {
+        std::unique_ptr<samples_per_direction> const* const  location_samples = cache.find((location_id::id_type)i);
+        if (*location_samples == nullptr)
+            continue;
+        writer.write((location_id::id_type)i);
+        for (std::deque<input_bits> const&  samples : **location_samples)
+        {
+            writer.write((natural_64_bit)samples.size());
+            for (input_bits const&  sample : samples)
+                writer.write(sample);
+        }
+    }
+}
+
+
+void  bitshare_analysis::load_checkpoint(checkpoint_reader&  reader)
+{
+    ASSUMPTION(is_ready() && num_cached_locations == 0UL);
+
+    reader.read(statistics);
+
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+    {
+        std::unique_ptr<samples_per_direction>&  location_samples = cache[reader.read<location_id::id_type>()];
+        reader.check(location_samples == nullptr);
+        location_samples = std::make_unique<samples_per_direction>();
+        ++num_cached_locations;
+        for (std::deque<input_bits>&  samples : *location_samples)
+            for (std::size_t  m = reader.read_size(); m != 0UL; --m)
+            {
+                samples.push_back({});
+                reader.read(samples.back());
+                samples_bytes += sample_bytes(samples.back());
+            }
+    }
+}
+
+
+bool  bitshare_analysis::generate_next_input(input_bits&  bits_ref)
 {
     TMPROF_BLOCK();
 
@@ -88,13 +135,19 @@ bool  bitshare_analysis::generate_next_input(vecb&  bits_ref)
         return false;
     }
 
-    vecb const&  sample_bits = samples_ptr->at(sample_index);
-    std::vector<stdin_bit_index>  bit_indices{ processed_node->get_sensitive_stdin_bits().begin(), processed_node->get_sensitive_stdin_bits().end() };
-    std::sort(bit_indices.begin(), bit_indices.end());
+    input_bits const&  sample_bits = samples_ptr->at(sample_index);
 
+    // The sample holds the sensitive bits in their order, so each range of them is copied at once.
     bits_ref = processed_node->get_best_stdin()->bits;
-    for (std::size_t  i = 0; i < sample_bits.size() && i < bit_indices.size(); ++i)
-        bits_ref.at(bit_indices.at(i)) = sample_bits.at(i);
+    std::size_t  sample_bit_index{ 0UL };
+    for (stdin_bit_set::range const&  r : processed_node->get_sensitive_stdin_bits().ranges())
+    {
+        std::size_t const  count{ std::min((std::size_t)(r.end - r.begin), sample_bits.size() - sample_bit_index) };
+        bits_ref.copy_bits(sample_bits, sample_bit_index, r.begin, count);
+        sample_bit_index += count;
+        if (sample_bit_index == sample_bits.size())
+            break;
+    }
 
     ++sample_index;
 
@@ -104,10 +157,10 @@ bool  bitshare_analysis::generate_next_input(vecb&  bits_ref)
 }
 
 
-void  bitshare_analysis::process_execution_results(execution_trace_pointer const  trace_ptr)
+void  bitshare_analysis::process_execution_results(stored_execution_trace const&  trace)
 {
     ASSUMPTION(is_busy());
-    ASSUMPTION(trace_ptr != nullptr);
+    ASSUMPTION(!trace.empty());
 
     if (!processed_node->is_direction_unexplored(false) && !processed_node->is_direction_unexplored(true))
         ++statistics.hits;
@@ -118,29 +171,39 @@ void  bitshare_analysis::process_execution_results(execution_trace_pointer const
 
 void  bitshare_analysis::bits_available_for_branching(
         branching_node* const  node_ptr,
-        execution_trace_pointer const  trace,
+        stored_execution_trace const&  trace,
         stdin_bits_and_types_pointer const  bits_and_types
         )
 {
     TMPROF_BLOCK();
 
     ASSUMPTION(node_ptr != nullptr && node_ptr->was_sensitivity_performed() && !node_ptr->get_sensitive_stdin_bits().empty());
-    ASSUMPTION(trace != nullptr && trace->size() > node_ptr->get_trace_index() && trace->at(node_ptr->get_trace_index()).id == node_ptr->get_location_id());
+    ASSUMPTION(trace.size() > node_ptr->get_trace_index() && trace.at(node_ptr->get_trace_index()).id == node_ptr->get_location_id());
     ASSUMPTION(bits_and_types != nullptr && !bits_and_types->bits.empty());
 
-    std::vector<stdin_bit_index>  bit_indices{ node_ptr->get_sensitive_stdin_bits().begin(), node_ptr->get_sensitive_stdin_bits().end() };
-    std::sort(bit_indices.begin(), bit_indices.end());
-
-    std::deque<vecb>&  samples = cache[node_ptr->get_location_id().id][trace->at(node_ptr->get_trace_index()).direction ? 1 : 0];
+    std::unique_ptr<samples_per_direction>&  location_samples = cache[node_ptr->get_location_id().id];
+    if (location_samples == nullptr)
+    {
+        location_samples = std::make_unique<samples_per_direction>();
+        ++num_cached_locations;
+    }
+    std::deque<input_bits>&  samples = (*location_samples)[trace.at(node_ptr->get_trace_index()).direction ? 1 : 0];
     samples.push_back({});
-    for (stdin_bit_index  idx : bit_indices)
-        samples.back().push_back(bits_and_types->bits.at(idx));
+    samples.back().resize(node_ptr->get_sensitive_stdin_bits().size());
+    std::size_t  sample_bit_index{ 0UL };
+    for (stdin_bit_set::range const&  r : node_ptr->get_sensitive_stdin_bits().ranges())
+    {
+        samples.back().copy_bits(bits_and_types->bits, r.begin, sample_bit_index, r.end - r.begin);
+        sample_bit_index += r.end - r.begin;
+    }
+    samples_bytes += sample_bytes(samples.back());
 
-    statistics.num_locations = std::max(statistics.num_locations, cache.size());
+    statistics.num_locations = std::max(statistics.num_locations, num_cached_locations);
     ++statistics.num_insertions;
 
     if (samples.size() > max_deque_size)
     {
+        samples_bytes -= sample_bytes(samples.front());
         samples.pop_front();
 
         ++statistics.num_deletions;
@@ -148,4 +211,29 @@ void  bitshare_analysis::bits_available_for_branching(
 }
 
 
+std::size_t  bitshare_analysis::evict_old_samples()
+{
+    if (is_busy())
+        return 0UL;
+
+    std::size_t  num_evicted{ 0UL };
+    for (std::size_t  i = 0UL; i != cache.num_slots(); ++i)
+    {
+        std::unique_ptr<samples_per_direction>* const  samples_ptr = cache.find((location_id::id_type)i);
+        if (*samples_ptr == nullptr)
+            continue;
+        for (std::deque<input_bits>&  samples : **samples_ptr)
+            for (std::size_t  n = samples.size() / 2UL; n != 0UL; --n, ++num_evicted)
+            {
+                samples_bytes -= sample_bytes(samples.front());
+                samples.pop_front();
+            }
+    }
+
+    statistics.num_evictions += num_evicted;
+
+    return num_evicted;
+}
+
+
 }
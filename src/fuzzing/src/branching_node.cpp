@@ -1,9 +1,70 @@
 #include <fuzzing/branching_node.hpp>
+#include <fuzzing/checkpoint.hpp>
 #include <utility/assumptions.hpp>
 
 namespace  fuzzing {
 
 
+object_pool<branching_node>&  branching_node::node_pool()
+{
+    static object_pool<branching_node>  pool;
+    return pool;
+}
+
+
+void*  branching_node::operator new(std::size_t const  size)
+{
+    ASSUMPTION(size == sizeof(branching_node));
+    return node_pool().allocate();
+}
+
+
+void  branching_node::operator delete(void* const  ptr)
+{
+    if (ptr != nullptr)
+        node_pool().deallocate(ptr);
+}
+
+
+object_pool_statistics  branching_node::get_node_memory_statistics()
+{
+    return node_pool().get_statistics();
+}
+
+
+object_pool<branching_node::analysis_data>&  branching_node::analysis_data_pool()
+{
+    static object_pool<branching_node::analysis_data>  pool;
+    return pool;
+}
+
+
+void*  branching_node::analysis_data::operator new(std::size_t const  size)
+{
+    ASSUMPTION(size == sizeof(analysis_data));
+    return analysis_data_pool().allocate();
+}
+
+
+void  branching_node::analysis_data::operator delete(void* const  ptr)
+{
+    if (ptr != nullptr)
+        analysis_data_pool().deallocate(ptr);
+}
+
+
+object_pool_statistics  branching_node::get_analysis_data_memory_statistics()
+{
+    return analysis_data_pool().get_statistics();
+}
+
+
+std::size_t  branching_node::get_memory_bytes_per_node()
+{
+    return object_pool<branching_node>::get_slot_bytes() + object_pool<analysis_data>::get_slot_bytes();
+}
+
+
 branching_node::branching_node(
         location_id const  id_,
         trace_index_type const  trace_index_,
@@ -11,85 +72,201 @@ branching_node::branching_node(
         bool const  xor_like_branching_function_,
         BRANCHING_PREDICATE const  branching_predicate_,
         branching_node* const  predecessor_,
+        branching_node* const  previous_occurrence_,
         stdin_bits_and_types_pointer const  best_stdin_,
-        execution_trace_pointer const  best_trace_,
-        br_instr_execution_trace_pointer const  best_br_instr_trace_,
-        natural_32_bit const  execution_number
+        stored_execution_trace const  best_trace_,
+        stored_br_instr_execution_trace const  best_br_instr_trace_,
+        cmp_operands_trace_pointer const  best_cmp_operands_trace_,
+        natural_32_bit const  execution_number,
+        guid_type const  guid_
         )
     : id{ id_ }
+    , predecessor{ predecessor_ }
+    , successors{}
+
     , trace_index{ trace_index_ }
+    , max_successors_trace_index{ trace_index_ }
     , num_stdin_bytes{ num_stdin_bytes_ }
-    , xor_like_branching_function{ xor_like_branching_function_ }
+    , guid__{ guid_ }
+
     , branching_predicate{ branching_predicate_ }
+    , xor_like_branching_function{ xor_like_branching_function_ }
+    , sensitivity_performed{ false }
+    , bitshare_performed{ false }
+    , local_search_performed{ false }
+    , closed{ false }
+
+    , data{ new analysis_data{
+            .previous_occurrence = previous_occurrence_,
+            .best_stdin = best_stdin_,
+            .best_trace = best_trace_,
+            .best_br_instr_trace = best_br_instr_trace_,
+            .best_cmp_operands_trace = best_cmp_operands_trace_,
+            .best_value = best_trace_.at(trace_index_).value,
+            .sensitive_stdin_bits = {},
+            .sensitivity_start_execution = std::numeric_limits<natural_32_bit>::max(),
+            .bitshare_start_execution = std::numeric_limits<natural_32_bit>::max(),
+            .local_search_start_execution = std::numeric_limits<natural_32_bit>::max(),
+            .best_value_execution = execution_number,
+            .num_coverage_failure_resets = 0U
+            } }
+{}
 
+
+branching_node::branching_node(checkpoint_reader&  reader, branching_node* const  predecessor_, guid_type const  guid_)
+    : id{ reader.read_location_id() }
     , predecessor{ predecessor_ }
     , successors{}
 
-    , best_stdin{ best_stdin_ }
-    , best_trace{ best_trace_ }
-    , best_br_instr_trace{ best_br_instr_trace_ }
-
-    , sensitive_stdin_bits{}
+    , trace_index{ reader.read<trace_index_type>() }
+    , max_successors_trace_index{ reader.read<trace_index_type>() }
+    , num_stdin_bytes{ reader.read<natural_32_bit>() }
+    , guid__{ guid_ }
 
+    , branching_predicate{ reader.read<BRANCHING_PREDICATE>() }
+    , xor_like_branching_function{ false }
     , sensitivity_performed{ false }
     , bitshare_performed{ false }
     , local_search_performed{ false }
     , closed{ false }
 
-    , sensitivity_start_execution{ std::numeric_limits<natural_32_bit>::max() }
-    , bitshare_start_execution{ std::numeric_limits<natural_32_bit>::max() }
-    , local_search_start_execution{ std::numeric_limits<natural_32_bit>::max() }
-    , best_value_execution{ execution_number }
+    , data{ new analysis_data{
+            .previous_occurrence = nullptr,
+            .best_stdin = nullptr,
+            .best_trace = {},
+            .best_br_instr_trace = {},
+            .best_cmp_operands_trace = nullptr,
+            .best_value = 0.0,
+            .sensitive_stdin_bits = {},
+            .sensitivity_start_execution = std::numeric_limits<natural_32_bit>::max(),
+            .bitshare_start_execution = std::numeric_limits<natural_32_bit>::max(),
+            .local_search_start_execution = std::numeric_limits<natural_32_bit>::max(),
+            .best_value_execution = 0U,
+            .num_coverage_failure_resets = 0U
+            } }
+{
+    natural_8_bit const  flags{ reader.read<natural_8_bit>() };
+    xor_like_branching_function = (flags & (1U << 0U)) != 0U;
+    sensitivity_performed = (flags & (1U << 1U)) != 0U;
+    bitshare_performed = (flags & (1U << 2U)) != 0U;
+    local_search_performed = (flags & (1U << 3U)) != 0U;
+    closed = (flags & (1U << 4U)) != 0U;
 
-    , max_successors_trace_index{ trace_index_ }
-    , num_coverage_failure_resets{ 0U }
+    for (bool const  direction : { false, true })
+    {
+        successor(direction).label = (successor_pointer::LABEL)reader.read<natural_8_bit>();
+        reader.check(successor(direction).label <= successor_pointer::VISITED);
+    }
 
-    , guid__{ get_fresh_guid__() }
-{}
+    data->previous_occurrence = reader.read_node();
+    reader.check(data->previous_occurrence == nullptr || data->previous_occurrence->get_location_id() == id);
+    data->best_stdin = reader.read_input();
+    reader.read(data->best_value);
+    reader.read(data->sensitive_stdin_bits);
+    reader.read(data->sensitivity_start_execution);
+    reader.read(data->bitshare_start_execution);
+    reader.read(data->local_search_start_execution);
+    reader.read(data->best_value_execution);
+    reader.read(data->num_coverage_failure_resets);
+}
+
+
+void  branching_node::save_checkpoint(checkpoint_writer&  writer) const
+{
+    writer.write(id);
+    writer.write(trace_index);
+    writer.write(max_successors_trace_index);
+    writer.write(num_stdin_bytes);
+    writer.write(branching_predicate);
+    writer.write((natural_8_bit)(
+            (xor_like_branching_function ? 1U << 0U : 0U) |
+            (sensitivity_performed ? 1U << 1U : 0U) |
+            (bitshare_performed ? 1U << 2U : 0U) |
+            (local_search_performed ? 1U << 3U : 0U) |
+            (closed ? 1U << 4U : 0U)
+            ));
+    for (bool const  direction : { false, true })
+        writer.write((natural_8_bit)successor(direction).label);
+
+    writer.write_node(data->previous_occurrence);
+    writer.write_input(data->best_stdin.get());
+    writer.write(data->best_value);
+    writer.write(data->sensitive_stdin_bits);
+    writer.write(data->sensitivity_start_execution);
+    writer.write(data->bitshare_start_execution);
+    writer.write(data->local_search_start_execution);
+    writer.write(data->best_value_execution);
+    writer.write(data->num_coverage_failure_resets);
+}
 
 
 void  branching_node::update_best_data(
         stdin_bits_and_types_pointer const  stdin_,
-        execution_trace_pointer const  trace_,
-        br_instr_execution_trace_pointer const  br_instr_trace_,
+        stored_execution_trace const  trace_,
+        stored_br_instr_execution_trace const  br_instr_trace_,
+        cmp_operands_trace_pointer const  cmp_operands_trace_,
         natural_32_bit const  execution_id_
         )
 {
-    best_stdin = stdin_;
-    best_trace = trace_;
-    best_br_instr_trace = br_instr_trace_;
-    best_value_execution = execution_id_;
+    data->best_stdin = stdin_;
+    data->best_trace = trace_;
+    data->best_br_instr_trace = br_instr_trace_;
+    data->best_cmp_operands_trace = cmp_operands_trace_;
+    data->best_value = trace_.at(trace_index).value;
+    data->best_value_execution = execution_id_;
+}
+
+
+void  branching_node::evict_best_trace()
+{
+    data->best_trace = {};
+    data->best_br_instr_trace = {};
+    data->best_cmp_operands_trace = nullptr;
+}
+
+
+void  branching_node::restore_best_trace(
+        stored_execution_trace const  trace_,
+        stored_br_instr_execution_trace const  br_instr_trace_,
+        cmp_operands_trace_pointer const  cmp_operands_trace_
+        )
+{
+    ASSUMPTION(is_best_trace_evicted() && trace_.size() > trace_index && trace_.at(trace_index).id == id);
+    data->best_trace = trace_;
+    data->best_br_instr_trace = br_instr_trace_;
+    data->best_cmp_operands_trace = cmp_operands_trace_;
 }
 
 
 void  branching_node::release_best_data(bool const  also_sensitive_bits)
 {
-    best_stdin = nullptr;
-    best_trace = nullptr;
-    best_br_instr_trace = nullptr;
+    data->best_stdin = nullptr;
+    data->best_trace = {};
+    data->best_br_instr_trace = {};
+    data->best_cmp_operands_trace = nullptr;
     if (also_sensitive_bits)
-        sensitive_stdin_bits.clear();
+        data->sensitive_stdin_bits.clear();
 }
 
 
 void  branching_node::set_sensitivity_performed(natural_32_bit  execution_id)
 {
     sensitivity_performed = true;
-    sensitivity_start_execution = execution_id;
+    data->sensitivity_start_execution = execution_id;
 }
 
 
 void  branching_node::set_bitshare_performed(natural_32_bit  execution_id)
 {
     bitshare_performed = true;
-    bitshare_start_execution = execution_id;
+    data->bitshare_start_execution = execution_id;
 }
 
 
 void  branching_node::set_local_search_performed(natural_32_bit  execution_id)
 {
     local_search_performed = true;
-    local_search_start_execution = execution_id;
+    data->local_search_start_execution = execution_id;
 }
 
 
@@ -97,19 +274,10 @@ void  branching_node::perform_failure_reset()
 {
     bitshare_performed = false;
     local_search_performed = false;
-    bitshare_start_execution = std::numeric_limits<natural_32_bit>::max();
-    local_search_start_execution = std::numeric_limits<natural_32_bit>::max();
+    data->bitshare_start_execution = std::numeric_limits<natural_32_bit>::max();
+    data->local_search_start_execution = std::numeric_limits<natural_32_bit>::max();
     closed = false;
-    ++num_coverage_failure_resets;
-}
-
-
-branching_node::guid_type  branching_node::get_fresh_guid__()
-{
-    static guid_type  fresh_guid_counter{ 0U };
-    guid_type const  result{ ++fresh_guid_counter };
-    ASSUMPTION(result != 0);
-    return result;
+    ++data->num_coverage_failure_resets;
 }
 
 
@@ -0,0 +1,22 @@
+#include <fuzzing/campaign_context.hpp>
+#include <utility/assumptions.hpp>
+
+namespace  fuzzing {
+
+
+campaign_context::campaign_context()
+    : io{}
+    , recorder{ io }
+    , last_guid{ 0U }
+{}
+
+
+branching_node::guid_type  campaign_context::fresh_guid()
+{
+    branching_node::guid_type const  result{ ++last_guid };
+    ASSUMPTION(result != 0);
+    return result;
+}
+
+
+}
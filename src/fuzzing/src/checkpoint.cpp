@@ -0,0 +1,218 @@
+#include <fuzzing/checkpoint.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace  fuzzing {
+
+
+static char const  CHECKPOINT_MAGIC[8]{ 'S', 'B', 'T', 'F', 'Z', 'C', 'H', 'K' };
+static natural_32_bit constexpr  CHECKPOINT_FORMAT_VERSION{ 4U };
+static natural_32_bit constexpr  CHECKPOINT_BYTE_ORDER_MARK{ 0x01020304U };
+
+static natural_32_bit constexpr  NULL_INDEX{ std::numeric_limits<natural_32_bit>::max() };
+
+
+checkpoint_writer::checkpoint_writer(std::ostream&  ostr_)
+    : ostr{ ostr_ }
+    , node_indices{}
+    , input_indices{}
+{
+    write_bytes(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    write(CHECKPOINT_FORMAT_VERSION);
+    write(CHECKPOINT_BYTE_ORDER_MARK);
+    write((natural_8_bit)sizeof(std::size_t));
+}
+
+
+bool  checkpoint_writer::good() const
+{
+    return ostr.good();
+}
+
+
+void  checkpoint_writer::write(std::string const&  value)
+{
+    write((natural_64_bit)value.size());
+    write_bytes(value.data(), value.size());
+}
+
+
+void  checkpoint_writer::write(input_bits const&  bits)
+{
+    write((natural_64_bit)bits.size());
+    write_bytes(bits.bytes().data(), bits.num_bytes());
+}
+
+
+void  checkpoint_writer::write(stdin_bit_set const&  bits)
+{
+    write_vector(bits.ranges());
+}
+
+
+void  checkpoint_writer::write_input(stdin_bits_and_types const* const  input)
+{
+    if (input == nullptr)
+    {
+        write(NULL_INDEX);
+        return;
+    }
+    auto const  it_and_state = input_indices.insert({ input, (natural_32_bit)input_indices.size() });
+    write(it_and_state.first->second);
+    if (!it_and_state.second)
+        return;
+    write_vector(input->bits.bytes());
+    write_vector(input->types);
+}
+
+
+void  checkpoint_writer::register_node(branching_node const* const  node)
+{
+    ASSUMPTION(node != nullptr);
+    auto const  it_and_state = node_indices.insert({ node, (natural_32_bit)node_indices.size() });
+    INVARIANT(it_and_state.second);
+}
+
+
+void  checkpoint_writer::write_node(branching_node const* const  node)
+{
+    write(node == nullptr ? NULL_INDEX : node_indices.at(node));
+}
+
+
+void  checkpoint_writer::write_bytes(void const* const  ptr, std::size_t const  num_bytes)
+{
+    ostr.write((char const*)ptr, (std::streamsize)num_bytes);
+}
+
+
+checkpoint_reader::checkpoint_reader(std::istream&  istr_)
+    : istr{ istr_ }
+    , remaining_bytes{ 0UL }
+    , nodes{}
+    , inputs{}
+{
+    std::istream::pos_type const  begin{ istr.tellg() };
+    istr.seekg(0, std::ios::end);
+    std::istream::pos_type const  end{ istr.tellg() };
+    istr.seekg(begin);
+    if (!istr.good() || end < begin)
+        throw std::runtime_error("Cannot read the checkpoint.");
+    remaining_bytes = (std::size_t)(end - begin);
+
+    char  magic[sizeof(CHECKPOINT_MAGIC)];
+    if (remaining_bytes < sizeof(magic))
+        throw std::runtime_error("The file is not a checkpoint of fuzzing.");
+    read_bytes(magic, sizeof(magic));
+    if (std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0)
+        throw std::runtime_error("The file is not a checkpoint of fuzzing.");
+    if (read<natural_32_bit>() != CHECKPOINT_FORMAT_VERSION)
+        throw std::runtime_error("The checkpoint was written in an unsupported format version.");
+    if (read<natural_32_bit>() != CHECKPOINT_BYTE_ORDER_MARK || read<natural_8_bit>() != (natural_8_bit)sizeof(std::size_t))
+        throw std::runtime_error("The checkpoint was written on an incompatible platform.");
+}
+
+
+void  checkpoint_reader::read(std::string&  value)
+{
+    value.resize(read_size());
+    read_bytes(value.data(), value.size());
+}
+
+
+void  checkpoint_reader::read(input_bits&  bits)
+{
+    natural_64_bit const  num_bits{ read<natural_64_bit>() };
+    check(num_bits / 8UL <= remaining_bytes);
+    vecu8  bytes((std::size_t)((num_bits + 7UL) / 8UL));
+    read_bytes(bytes.data(), bytes.size());
+    bits.clear();
+    for (std::size_t  i = 0UL; i != (std::size_t)num_bits; ++i)
+        bits.push_back(get_bit(&bytes[i >> 3U], (natural_8_bit)(i & 7U)));
+}
+
+
+void  checkpoint_reader::read(stdin_bit_set&  bits)
+{
+    std::vector<stdin_bit_set::range>  ranges;
+    read_vector(ranges);
+    bits.clear();
+    for (stdin_bit_set::range const&  r : ranges)
+    {
+        check(r.begin < r.end);
+        bits.insert(r.begin, r.end);
+    }
+}
+
+
+std::size_t  checkpoint_reader::read_size(std::size_t const  min_bytes_per_element)
+{
+    natural_64_bit const  size{ read<natural_64_bit>() };
+    check(size <= remaining_bytes / std::max(min_bytes_per_element, (std::size_t)1UL));
+    return (std::size_t)size;
+}
+
+
+stdin_bits_and_types_pointer  checkpoint_reader::read_input()
+{
+    natural_32_bit const  index{ read<natural_32_bit>() };
+    if (index == NULL_INDEX)
+        return nullptr;
+    if (index < inputs.size())
+        return inputs.at(index);
+    check(index == inputs.size());
+    vecu8  bytes;
+    read_vector(bytes);
+    stdin_bits_and_types::vect  types;
+    read_vector(types);
+    natural_32_bit  num_types_bits{ 0U };
+    for (stdin_bits_and_types::type_of_input_bits const  type : types)
+        num_types_bits += num_bits(type);
+    check(num_types_bits == 8U * bytes.size());
+    inputs.push_back(std::make_shared<stdin_bits_and_types>(bytes, types));
+    return inputs.back();
+}
+
+
+void  checkpoint_reader::register_node(branching_node* const  node)
+{
+    ASSUMPTION(node != nullptr);
+    nodes.push_back(node);
+}
+
+
+branching_node*  checkpoint_reader::read_node()
+{
+    natural_32_bit const  index{ read<natural_32_bit>() };
+    if (index == NULL_INDEX)
+        return nullptr;
+    check(index < nodes.size());
+    return nodes.at(index);
+}
+
+
+void  checkpoint_reader::check(bool const  condition) const
+{
+    if (!condition)
+        throw std::runtime_error("The checkpoint is corrupted.");
+}
+
+
+void  checkpoint_reader::read_bytes(void* const  ptr, std::size_t const  num_bytes)
+{
+    if (num_bytes > remaining_bytes)
+        throw std::runtime_error("The checkpoint is truncated.");
+    istr.read((char*)ptr, (std::streamsize)num_bytes);
+    if (!istr.good())
+        throw std::runtime_error("Cannot read the checkpoint.");
+    remaining_bytes -= num_bytes;
+}
+
+
+}
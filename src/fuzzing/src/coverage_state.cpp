@@ -0,0 +1,182 @@
+#include <fuzzing/coverage_state.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <algorithm>
+
+namespace  fuzzing {
+
+
+coverage_state::coverage_state(std::size_t const  num_ids)
+    : ids(num_ids + 1U)
+    , tables{}
+    , num_covered_{ 0UL }
+    , num_uncovered_{ 0UL }
+{}
+
+
+void  coverage_state::reserve_ids(std::size_t const  num_ids)
+{
+    if (num_ids + 1U > ids.size())
+        ids.resize(num_ids + 1U);
+}
+
+
+coverage_state::VISIT_RESULT  coverage_state::visit(location_id const  id, bool const  direction)
+{
+    bits_type const  old_bits{ get_bits(id) };
+    if (old_bits == BOTH_DIRECTIONS)
+        return ALREADY_COVERED;
+    bits_type const  new_bits = old_bits | direction_bit(direction);
+    if (new_bits == old_bits)
+        return STILL_UNCOVERED;
+    update_bits(id, new_bits);
+    return old_bits == NO_DIRECTION ? DISCOVERED : COVERED;
+}
+
+
+void  coverage_state::insert_covered(location_id const  id)
+{
+    update_bits(id, BOTH_DIRECTIONS);
+}
+
+
+void  coverage_state::insert_uncovered(location_id const  id, bool const  uncovered_direction)
+{
+    update_bits(id, get_bits(id) | direction_bit(!uncovered_direction));
+}
+
+
+void  coverage_state::collect_covered(std::vector<location_id>&  output) const
+{
+    output.clear();
+    output.reserve(num_covered_);
+    for_each_entry([&output](location_id const  id, bits_type const  bits) {
+        if (bits == BOTH_DIRECTIONS)
+            output.push_back(id);
+    });
+    std::sort(output.begin(), output.end());
+}
+
+
+void  coverage_state::collect_uncovered(std::vector<branching_location_and_direction>&  output) const
+{
+    output.clear();
+    output.reserve(num_uncovered_);
+    for_each_entry([&output](location_id const  id, bits_type const  bits) {
+        if (bits != BOTH_DIRECTIONS)
+            output.push_back({ id, bits == direction_bit(false) });
+    });
+    std::sort(output.begin(), output.end());
+}
+
+
+coverage_state::bits_type  coverage_state::get_bits(location_id const  id) const
+{
+    if (id.id >= ids.size())
+        return NO_DIRECTION;
+    id_entry const&  entry = ids[id.id];
+    if (entry.first.bits == NO_DIRECTION || entry.first.context_hash == id.context_hash)
+        return entry.first.bits;
+    if (entry.table_index == NO_TABLE)
+        return NO_DIRECTION;
+    return find_slot(tables[entry.table_index], id.context_hash)->bits;
+}
+
+
+coverage_state::bits_type&  coverage_state::get_or_insert_bits(location_id const  id)
+{
+    if (id.id >= ids.size())
+        ids.resize(std::max((std::size_t)id.id + 1U, 2U * ids.size()));
+    id_entry&  entry = ids[id.id];
+    if (entry.first.bits == NO_DIRECTION || entry.first.context_hash == id.context_hash)
+    {
+        entry.first.context_hash = id.context_hash;
+        return entry.first.bits;
+    }
+    if (entry.table_index == NO_TABLE)
+    {
+        entry.table_index = (natural_32_bit)tables.size();
+        tables.push_back({ std::vector<context_entry>(4U), 0UL });
+    }
+    context_table&  table = tables[entry.table_index];
+    context_entry*  slot = find_slot(table, id.context_hash);
+    if (slot->bits == NO_DIRECTION)
+    {
+        if (2U * (table.size + 1U) > table.slots.size())
+        {
+            std::vector<context_entry>  old_slots(2U * table.slots.size());
+            old_slots.swap(table.slots);
+            for (context_entry const&  old_slot : old_slots)
+                if (old_slot.bits != NO_DIRECTION)
+                    *find_slot(table, old_slot.context_hash) = old_slot;
+            slot = find_slot(table, id.context_hash);
+        }
+        slot->context_hash = id.context_hash;
+        ++table.size;
+    }
+    return slot->bits;
+}
+
+
+void  coverage_state::update_bits(location_id const  id, bits_type const  new_bits)
+{
+    ASSUMPTION(new_bits != NO_DIRECTION);
+
+    bits_type&  bits = get_or_insert_bits(id);
+    if (bits == new_bits)
+        return;
+    if (bits != NO_DIRECTION)
+    {
+        INVARIANT(bits != BOTH_DIRECTIONS && num_uncovered_ > 0UL);
+        --num_uncovered_;
+    }
+    if (new_bits == BOTH_DIRECTIONS)
+        ++num_covered_;
+    else
+        ++num_uncovered_;
+    bits = new_bits;
+}
+
+
+std::size_t  coverage_state::slot_index(location_id::context_type const  context_hash, std::size_t const  num_slots)
+{
+    return (std::size_t)(((natural_64_bit)context_hash * 0x9E3779B97F4A7C15ULL) >> 32U) & (num_slots - 1U);
+}
+
+
+coverage_state::context_entry*  coverage_state::find_slot(context_table&  table, location_id::context_type const  context_hash)
+{
+    return const_cast<context_entry*>(find_slot(static_cast<context_table const&>(table), context_hash));
+}
+
+
+coverage_state::context_entry const*  coverage_state::find_slot(context_table const&  table, location_id::context_type const  context_hash)
+{
+    std::size_t const  mask{ table.slots.size() - 1U };
+    for (std::size_t  i = slot_index(context_hash, table.slots.size()); true; i = (i + 1U) & mask)
+    {
+        context_entry const&  slot = table.slots[i];
+        if (slot.bits == NO_DIRECTION || slot.context_hash == context_hash)
+            return &slot;
+    }
+}
+
+
+template<typename F>
+void  coverage_state::for_each_entry(F const&  visitor) const
+{
+    for (std::size_t  i = 0UL; i != ids.size(); ++i)
+    {
+        id_entry const&  entry = ids[i];
+        if (entry.first.bits == NO_DIRECTION)
+            continue;
+        visitor(location_id{ (location_id::id_type)i, entry.first.context_hash }, entry.first.bits);
+        if (entry.table_index != NO_TABLE)
+            for (context_entry const&  slot : tables[entry.table_index].slots)
+                if (slot.bits != NO_DIRECTION)
+                    visitor(location_id{ (location_id::id_type)i, slot.context_hash }, slot.bits);
+    }
+}
+
+
+}
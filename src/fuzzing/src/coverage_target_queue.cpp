@@ -0,0 +1,286 @@
+#include <fuzzing/coverage_target_queue.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <cstdlib>
+#include <tuple>
+
+namespace  fuzzing {
+
+
+bool  coverage_target_queue::node_key::same_priority(node_key const&  other) const
+{
+    return  num_sensitive_bits == other.num_sensitive_bits &&
+            distance_to_central_input_width_class == other.distance_to_central_input_width_class &&
+            num_stdin_bytes == other.num_stdin_bytes &&
+            trace_index == other.trace_index;
+}
+
+
+bool  coverage_target_queue::node_key::operator<(node_key const&  other) const
+{
+    return  std::tie(num_sensitive_bits, distance_to_central_input_width_class, num_stdin_bytes, trace_index, guid) <
+            std::tie(other.num_sensitive_bits, other.distance_to_central_input_width_class, other.num_stdin_bytes,
+                     other.trace_index, other.guid);
+}
+
+
+bool  coverage_target_queue::bucket_key::operator<(bucket_key const&  other) const
+{
+    if (count != other.count)
+        return count < other.count;
+    if (best < other.best)
+        return true;
+    if (other.best < best)
+        return false;
+    return location < other.location;
+}
+
+
+coverage_target_queue::coverage_target_queue(
+        std::size_t const  num_locations,
+        input_width_class_function const  input_width_class_
+        )
+    : nodes{}
+    , buckets{ num_locations }
+    , order{}
+    , input_width_class{ input_width_class_ }
+    , central_input_width_class{ 0U }
+    , epoch{ 0U }
+{
+    ASSUMPTION(input_width_class != nullptr);
+}
+
+
+bool  coverage_target_queue::get_flag(branching_node* const  node) const
+{
+    auto const  it = nodes.find(node);
+    ASSUMPTION(it != nodes.end());
+    return it->second.flag;
+}
+
+
+void  coverage_target_queue::set_flag(branching_node* const  node)
+{
+    auto const  it = nodes.find(node);
+    ASSUMPTION(it != nodes.end());
+    it->second.flag = true;
+}
+
+
+bool  coverage_target_queue::insert(branching_node* const  node, bool const  flag)
+{
+    ASSUMPTION(node != nullptr);
+    auto const  it_and_state = nodes.insert({ node, { make_key(node), flag } });
+    if (!it_and_state.second)
+        return false;
+    insert_key(it_and_state.first->second.key);
+    return true;
+}
+
+
+bool  coverage_target_queue::erase(branching_node* const  node)
+{
+    auto const  it = nodes.find(node);
+    if (it == nodes.end())
+        return false;
+    erase_key(it->second.key);
+    nodes.erase(it);
+    return true;
+}
+
+
+bool  coverage_target_queue::update(branching_node* const  node)
+{
+    auto const  it = nodes.find(node);
+    if (it == nodes.end())
+        return false;
+    erase_key(it->second.key);
+    it->second.key = make_key(node);
+    insert_key(it->second.key);
+    return true;
+}
+
+
+void  coverage_target_queue::clear()
+{
+    for (auto const&  node_and_props : nodes)
+    {
+        bucket&  b = buckets[node_and_props.first->get_location_id().id];
+        b.nodes.clear();
+        b.epoch_emptied = epoch;
+    }
+    nodes.clear();
+    order.clear();
+}
+
+
+branching_node*  coverage_target_queue::get_best(natural_32_bit const  max_input_width)
+{
+    if (nodes.empty())
+        return nullptr;
+
+    set_central_input_width_class(input_width_class(max_input_width / 2U));
+
+    // Among nodes equal in the indexed keys we prefer the one with the greatest trace
+    // index of successors. There are only few such nodes (typically just one).
+    auto  it_bucket = order.begin();
+    branching_node*  best{ it_bucket->best.node };
+    for ( ; it_bucket != order.end() && it_bucket->count == order.begin()->count
+                && it_bucket->best.same_priority(order.begin()->best); ++it_bucket)
+    {
+        bucket const&  b = buckets[it_bucket->location];
+        for (auto  it = b.nodes.begin(); it != b.nodes.end() && it->same_priority(order.begin()->best); ++it)
+            if (it->node->get_max_successors_trace_index() > best->get_max_successors_trace_index())
+                best = it->node;
+    }
+
+    return best;
+}
+
+
+void  coverage_target_queue::increment_count(branching_node* const  node)
+{
+    ASSUMPTION(contains(node));
+    location_id::id_type const  location{ node->get_location_id().id };
+    bucket&  b = buckets[location];
+    ++epoch;
+    order.erase(make_bucket_key(location, b));
+    ++b.count;
+    order.insert(make_bucket_key(location, b));
+}
+
+
+void  coverage_target_queue::save_checkpoint(checkpoint_writer&  writer) const
+{
+    writer.write(central_input_width_class);
+    writer.write(epoch);
+
+    writer.write((natural_64_bit)nodes.size());
+    for (auto const&  node_and_props : nodes)
+    {
+        writer.write_node(node_and_props.first);
+        writer.write(node_and_props.second.flag);
+    }
+
+    natural_64_bit  num_buckets{ 0UL };
+    for (std::size_t  i = 0UL; i != buckets.num_slots(); ++i)
+        if (buckets.find((location_id::id_type)i)->count != 0U || buckets.find((location_id::id_type)i)->epoch_emptied != 0U)
+            ++num_buckets;
+    writer.write(num_buckets);
+    for (std::size_t  i = 0UL; i != buckets.num_slots(); ++i)
+    {
+        bucket const&  b = *buckets.find((location_id::id_type)i);
+        if (b.count != 0U || b.epoch_emptied != 0U)
+        {
+            writer.write((location_id::id_type)i);
+            writer.write(b.count);
+            writer.write(b.epoch_emptied);
+        }
+    }
+}
+
+
+void  coverage_target_queue::load_checkpoint(checkpoint_reader&  reader)
+{
+    ASSUMPTION(empty());
+
+    reader.read(central_input_width_class);
+    reader.read(epoch);
+
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+    {
+        branching_node* const  node{ reader.read_node() };
+        bool const  flag{ reader.read<bool>() };
+        reader.check(node != nullptr && insert(node, flag));
+    }
+
+    // The counts are restored after all nodes are inserted, because the insertion may reset them.
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+    {
+        location_id::id_type const  location{ reader.read<location_id::id_type>() };
+        bucket&  b = buckets[location];
+        if (!b.nodes.empty())
+            order.erase(make_bucket_key(location, b));
+        reader.read(b.count);
+        reader.read(b.epoch_emptied);
+        if (!b.nodes.empty())
+            order.insert(make_bucket_key(location, b));
+    }
+}
+
+
+coverage_target_queue::node_key  coverage_target_queue::make_key(branching_node* const  node) const
+{
+    return {
+        .num_sensitive_bits = (natural_32_bit)node->get_sensitive_stdin_bits().size(),
+        .distance_to_central_input_width_class = (natural_32_bit)std::abs(
+                (integer_32_bit)central_input_width_class -
+                (integer_32_bit)input_width_class(node->get_num_stdin_bytes())
+                ),
+        .num_stdin_bytes = node->get_num_stdin_bytes(),
+        .trace_index = node->get_trace_index(),
+        .guid = node->guid(),
+        .node = node
+    };
+}
+
+
+coverage_target_queue::bucket_key  coverage_target_queue::make_bucket_key(
+        location_id::id_type const  location,
+        bucket const&  b
+        ) const
+{
+    INVARIANT(!b.nodes.empty());
+    return { b.count, *b.nodes.begin(), location };
+}
+
+
+void  coverage_target_queue::insert_key(node_key const&  key)
+{
+    location_id::id_type const  location{ key.node->get_location_id().id };
+    bucket&  b = buckets[location];
+    if (b.nodes.empty())
+    {
+        // There was a selection while the location was not in the queue.
+        if (b.epoch_emptied != epoch)
+            b.count = 0U;
+    }
+    else
+        order.erase(make_bucket_key(location, b));
+    b.nodes.insert(key);
+    order.insert(make_bucket_key(location, b));
+}
+
+
+void  coverage_target_queue::erase_key(node_key const&  key)
+{
+    location_id::id_type const  location{ key.node->get_location_id().id };
+    bucket&  b = buckets[location];
+    order.erase(make_bucket_key(location, b));
+    b.nodes.erase(key);
+    if (b.nodes.empty())
+        b.epoch_emptied = epoch;
+    else
+        order.insert(make_bucket_key(location, b));
+}
+
+
+void  coverage_target_queue::set_central_input_width_class(natural_32_bit const  input_width_class_)
+{
+    if (input_width_class_ == central_input_width_class)
+        return;
+
+    // The class changes only a few times during the whole fuzzing (the maximal input
+    // width only grows), so we can afford rebuilding the whole index.
+    for (auto const&  node_and_props : nodes)
+        erase_key(node_and_props.second.key);
+    central_input_width_class = input_width_class_;
+    for (auto&  node_and_props : nodes)
+    {
+        node_and_props.second.key = make_key(node_and_props.first);
+        insert_key(node_and_props.second.key);
+    }
+}
+
+
+}
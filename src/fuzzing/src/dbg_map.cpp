@@ -0,0 +1,85 @@
+#include <fuzzing/dbg_map.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace bip = boost::interprocess;
+
+using namespace instrumentation;
+
+namespace  fuzzing {
+
+
+void  dbg_map::open(std::filesystem::path const&  pathname)
+{
+    close();
+
+    try
+    {
+        file = bip::file_mapping(pathname.string().c_str(), bip::read_only);
+        region = bip::mapped_region(file, bip::read_only);
+    }
+    catch (bip::interprocess_exception const&  e)
+    {
+        close();
+        throw std::runtime_error("Cannot map the debug map file '" + pathname.string() + "': " + e.what());
+    }
+
+    natural_8_bit const* const  data = static_cast<natural_8_bit const*>(region.get_address());
+    std::size_t const  size = region.get_size();
+
+    auto const  is_malformed = [data, size]() {
+        if (size < sizeof(dbg_map_header))
+            return true;
+        dbg_map_header const* const  hdr = reinterpret_cast<dbg_map_header const*>(data);
+        if (std::memcmp(hdr->magic, dbg_map_header::magic_value, sizeof(hdr->magic)) != 0
+                || hdr->version != dbg_map_header::current_version
+                || (natural_64_bit)size != (natural_64_bit)sizeof(dbg_map_header)
+                                            + (natural_64_bit)hdr->num_entries * sizeof(dbg_map_entry)
+                                            + (natural_64_bit)hdr->names_size)
+            return true;
+        dbg_map_entry const* const  first = reinterpret_cast<dbg_map_entry const*>(data + sizeof(dbg_map_header));
+        dbg_map_entry const* const  last = first + hdr->num_entries;
+        char const* const  names = reinterpret_cast<char const*>(last);
+        // When the last name is terminated, so are all names starting in the section.
+        if (hdr->names_size != 0U && names[hdr->names_size - 1U] != '\0')
+            return true;
+        for (dbg_map_entry const*  it = first; it != last; ++it)
+            if (it->function_name >= hdr->names_size || (it != first && (it - 1)->id > it->id))
+                return true;
+        return false;
+    };
+    if (is_malformed())
+    {
+        close();
+        throw std::runtime_error("The debug map file '" + pathname.string() + "' is malformed.");
+    }
+
+    header = reinterpret_cast<dbg_map_header const*>(data);
+    entries = reinterpret_cast<dbg_map_entry const*>(data + sizeof(dbg_map_header));
+    names = reinterpret_cast<char const*>(entries + header->num_entries);
+}
+
+
+void  dbg_map::close()
+{
+    header = nullptr;
+    entries = nullptr;
+    names = nullptr;
+    region = bip::mapped_region{};
+    file = bip::file_mapping{};
+}
+
+
+dbg_map_entry const*  dbg_map::find(natural_32_bit const  id) const
+{
+    dbg_map_entry const* const  it = std::lower_bound(
+            begin(), end(), id, [](dbg_map_entry const&  entry, natural_32_bit const  id) { return entry.id < id; }
+            );
+    return it != end() && it->id == id ? it : nullptr;
+}
+
+
+}
@@ -25,7 +25,14 @@ void  print_fuzzing_configuration(
          << shift << "\"benchmark\": \"" << benchmark << "\",\n"
          << shift << "\"max_executions\": " << terminator.max_executions << ",\n"
          << shift << "\"max_seconds\": " << terminator.max_seconds << ",\n"
+         << shift << "\"max_server_megabytes\": " << terminator.max_server_megabytes << ",\n"
+         << shift << "\"lossy_eviction\": " << (terminator.lossy_eviction ? "true" : "false") << ",\n"
+         << shift << "\"execution_cache_megabytes\": " << terminator.execution_cache_megabytes << ",\n"
+         << shift << "\"max_local_searches\": " << terminator.max_local_searches << ",\n"
+         << shift << "\"random_seed\": " << terminator.random_seed << ",\n"
+         << shift << "\"deterministic\": " << (terminator.deterministic ? "true" : "false") << ",\n"
          << shift << "\"max_trace_length\": " << ioconfig.max_trace_length << ",\n"
+         << shift << "\"cmp_operands\": " << (ioconfig.cmp_operands ? "true" : "false") << ",\n"
          << shift << "\"max_br_instr_trace_length\": " << ioconfig.max_br_instr_trace_length << ",\n"
          << shift << "\"max_stack_size\": " << ioconfig.max_stack_size << ",\n"
          << shift << "\"max_stdin_bytes\": " << ioconfig.max_stdin_bytes << ",\n"
@@ -84,6 +91,9 @@ void  print_analysis_outcomes(std::ostream&  ostr, analysis_outcomes const&  res
     case analysis_outcomes::TERMINATION_TYPE::UNCLASSIFIED_ERROR:
         ostr << "UNCLASSIFIED_ERROR";
         break;
+    case analysis_outcomes::TERMINATION_TYPE::INTERRUPTED:
+        ostr << "INTERRUPTED";
+        break;
     default: { UNREACHABLE(); break; }
     }
     ostr << "\",\n";
@@ -190,7 +200,8 @@ void  print_analysis_outcomes(std::ostream&  ostr, analysis_outcomes const&  res
          << shift << shift << "\"stop_calls_instant\": " << results.bitshare_statistics.stop_calls_instant << ",\n"
          << shift << shift << "\"num_locations\": " << results.bitshare_statistics.num_locations << ",\n"
          << shift << shift << "\"num_insertions\": " << results.bitshare_statistics.num_insertions << ",\n"
-         << shift << shift << "\"num_deletions\": " << results.bitshare_statistics.num_deletions << "\n"
+         << shift << shift << "\"num_deletions\": " << results.bitshare_statistics.num_deletions << ",\n"
+         << shift << shift << "\"num_evictions\": " << results.bitshare_statistics.num_evictions << "\n"
          << shift << "},\n"
          << shift << "\"local_search_analysis\": {\n"
          << shift << shift << "\"generated_inputs\": " << results.local_search_statistics.generated_inputs << ",\n"
@@ -199,6 +210,13 @@ void  print_analysis_outcomes(std::ostream&  ostr, analysis_outcomes const&  res
          << shift << shift << "\"stop_calls_early\": " << results.local_search_statistics.stop_calls_early << ",\n"
          << shift << shift << "\"stop_calls_failed\": " << results.local_search_statistics.stop_calls_failed << "\n"
          << shift << "},\n"
+         << shift << "\"input_to_state_analysis\": {\n"
+         << shift << shift << "\"generated_inputs\": " << results.input_to_state_statistics.generated_inputs << ",\n"
+         << shift << shift << "\"start_calls\": " << results.input_to_state_statistics.start_calls << ",\n"
+         << shift << shift << "\"start_calls_failed\": " << results.input_to_state_statistics.start_calls_failed << ",\n"
+         << shift << shift << "\"stop_calls_success\": " << results.input_to_state_statistics.stop_calls_success << ",\n"
+         << shift << shift << "\"stop_calls_depleted\": " << results.input_to_state_statistics.stop_calls_depleted << "\n"
+         << shift << "},\n"
          << shift << "\"bitflip_analysis\": {\n"
          << shift << shift << "\"generated_inputs\": " << results.bitflip_statistics.generated_inputs << ",\n"
          << shift << shift << "\"max_bits\": " << results.bitflip_statistics.max_bits << ",\n"
@@ -222,7 +240,44 @@ void  print_analysis_outcomes(std::ostream&  ostr, analysis_outcomes const&  res
          << shift << shift << "\"strategy_iid_twins_sensitive\": " << results.fuzzer_statistics.strategy_iid_twins_sensitive << ",\n"
          << shift << shift << "\"strategy_iid_twins_others\": " << results.fuzzer_statistics.strategy_iid_twins_others << ",\n"
          << shift << shift << "\"strategy_monte_carlo\": " << results.fuzzer_statistics.strategy_monte_carlo << ",\n"
-         << shift << shift << "\"coverage_failure_resets\": " << results.fuzzer_statistics.coverage_failure_resets << "\n"
+         << shift << shift << "\"coverage_failure_resets\": " << results.fuzzer_statistics.coverage_failure_resets << ",\n"
+         << shift << shift << "\"node_memory_live_bytes\": " << results.fuzzer_statistics.node_memory_live_bytes << ",\n"
+         << shift << shift << "\"node_memory_reserved_bytes\": " << results.fuzzer_statistics.node_memory_reserved_bytes << ",\n"
+         << shift << shift << "\"node_memory_max_live_nodes\": " << results.fuzzer_statistics.node_memory_max_live_nodes << ",\n"
+         << shift << shift << "\"node_memory_fragmentation\": " << results.fuzzer_statistics.node_memory_fragmentation << ",\n"
+         << shift << shift << "\"trace_chunks_created\": " << results.fuzzer_statistics.trace_chunks_created << ",\n"
+         << shift << shift << "\"trace_chunks_shared\": " << results.fuzzer_statistics.trace_chunks_shared << ",\n"
+         << shift << shift << "\"trace_chunks_indexed\": " << results.fuzzer_statistics.trace_chunks_indexed << ",\n"
+         << shift << shift << "\"loop_detection_queries\": " << results.fuzzer_statistics.loop_detection_queries << ",\n"
+         << shift << shift << "\"loop_detection_cached_nodes\": " << results.fuzzer_statistics.loop_detection_cached_nodes << ",\n"
+         << shift << shift << "\"loop_detection_nodes_walked\": " << results.fuzzer_statistics.loop_detection_nodes_walked << ",\n"
+         << shift << shift << "\"memory_checks\": " << results.fuzzer_statistics.memory_checks << ",\n"
+         << shift << shift << "\"memory_nodes_bytes\": " << results.fuzzer_statistics.memory_nodes_bytes << ",\n"
+         << shift << shift << "\"memory_traces_bytes\": " << results.fuzzer_statistics.memory_traces_bytes << ",\n"
+         << shift << shift << "\"memory_inputs_bytes\": " << results.fuzzer_statistics.memory_inputs_bytes << ",\n"
+         << shift << shift << "\"memory_bitshare_bytes\": " << results.fuzzer_statistics.memory_bitshare_bytes << ",\n"
+         << shift << shift << "\"memory_iid_histograms_bytes\": " << results.fuzzer_statistics.memory_iid_histograms_bytes << ",\n"
+         << shift << shift << "\"memory_execution_cache_bytes\": " << results.fuzzer_statistics.memory_execution_cache_bytes << ",\n"
+         << shift << shift << "\"memory_budget_overruns\": " << results.fuzzer_statistics.memory_budget_overruns << ",\n"
+         << shift << shift << "\"evicted_traces\": " << results.fuzzer_statistics.evicted_traces << ",\n"
+         << shift << shift << "\"rebuilt_traces\": " << results.fuzzer_statistics.rebuilt_traces << ",\n"
+         << shift << shift << "\"failed_rebuilds\": " << results.fuzzer_statistics.failed_rebuilds << ",\n"
+         << shift << shift << "\"evicted_bitshare_samples\": " << results.fuzzer_statistics.evicted_bitshare_samples << ",\n"
+         << shift << shift << "\"seed_inputs\": " << results.fuzzer_statistics.seed_inputs << ",\n"
+         << shift << shift << "\"seed_inputs_contributing\": " << results.fuzzer_statistics.seed_inputs_contributing << ",\n"
+         << shift << shift << "\"buffer_acquisitions\": " << results.fuzzer_statistics.buffer_acquisitions << ",\n"
+         << shift << shift << "\"buffer_allocations\": " << results.fuzzer_statistics.buffer_allocations << ",\n"
+         << shift << shift << "\"buffer_allocations_per_execution\": " << results.fuzzer_statistics.buffer_allocations_per_execution << ",\n"
+         << shift << shift << "\"trace_records_mapped\": " << results.fuzzer_statistics.trace_records_mapped << ",\n"
+         << shift << shift << "\"trace_records_in_explored_prefix\": " << results.fuzzer_statistics.trace_records_in_explored_prefix << "\n"
+         << shift << "},\n"
+         << shift << "\"execution_cache\": {\n"
+         << shift << shift << "\"lookups\": " << results.execution_cache_statistics.lookups << ",\n"
+         << shift << shift << "\"hits\": " << results.execution_cache_statistics.hits << ",\n"
+         << shift << shift << "\"insertions\": " << results.execution_cache_statistics.insertions << ",\n"
+         << shift << shift << "\"evictions\": " << results.execution_cache_statistics.evictions << ",\n"
+         << shift << shift << "\"rejections\": " << results.execution_cache_statistics.rejections << ",\n"
+         << shift << shift << "\"max_bytes\": " << results.execution_cache_statistics.max_bytes << "\n"
          << shift << "},\n"
          ;
 
@@ -257,7 +312,9 @@ void  print_analysis_outcomes(std::ostream&  ostr, analysis_outcomes const&  res
         ostr << shift << shift << '\"' << it->first << "\": {\n";
         ostr << shift << shift << shift << "\"num_generated_tests\": " << it->second.num_generated_tests << ",\n";
         ostr << shift << shift << shift << "\"num_crashes\": " << it->second.num_crashes << ",\n";
-        ostr << shift << shift << shift << "\"num_boundary_violations\": " << it->second.num_boundary_violations << "\n";
+        ostr << shift << shift << shift << "\"num_boundary_violations\": " << it->second.num_boundary_violations << ",\n";
+        ostr << shift << shift << shift << "\"num_executions\": " << it->second.num_executions << ",\n";
+        ostr << shift << shift << shift << "\"num_cached_executions\": " << it->second.num_cached_executions << "\n";
         ostr << shift << shift << '}' << (std::next(it) != results.output_statistics.end() ? "," : "") << '\n';
     }
     ostr << shift << "}\n";
@@ -286,6 +343,42 @@ void  save_analysis_outcomes(
 }
 
 
+void  print_uncovered_locations(std::ostream&  ostr, analysis_outcomes const&  results, dbg_map const&  cond_map)
+{
+    std::string const  shift = "    ";
+    ostr << "[";
+    bool  first{ true };
+    for (auto const&  loc_and_direction : results.uncovered_branchings)
+    {
+        instrumentation::dbg_map_entry const* const  entry{ cond_map.find(loc_and_direction.first.id) };
+        if (entry == nullptr)
+            continue;
+        ostr << (first ? "\n" : ",\n") << shift << "{ "
+             << "\"id\": " << loc_and_direction.first.id << ", "
+             << "\"context_hash\": " << loc_and_direction.first.context_hash << ", "
+             << "\"direction\": " << (loc_and_direction.second ? 1 : 0) << ", "
+             << "\"function\": \"" << cond_map.function_name(*entry) << "\", "
+             << "\"line\": " << entry->line << ", "
+             << "\"column\": " << entry->column << " }";
+        first = false;
+    }
+    ostr << "\n]";
+}
+
+
+void  save_uncovered_locations(
+        std::filesystem::path const&  output_dir,
+        std::string const&  benchmark,
+        analysis_outcomes const&  results,
+        dbg_map const&  cond_map
+        )
+{
+    std::filesystem::path const  test_file_path = output_dir / (benchmark + "_uncovered_locations.json");
+    std::ofstream  ostr(test_file_path.c_str(), std::ios::binary);
+    print_uncovered_locations(ostr, results, cond_map);
+}
+
+
 void  print_optimization_configuration(std::ostream&  ostr, optimizer::configuration const&  config)
 {
     std::string const  shift = "    ";
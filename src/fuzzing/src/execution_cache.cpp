@@ -0,0 +1,93 @@
+#include <fuzzing/execution_cache.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <utility/timeprof.hpp>
+#include <algorithm>
+
+namespace  fuzzing {
+
+
+execution_cache::execution_cache(iomodels::iomanager&  io_, std::size_t const  max_bytes_)
+    : io{ io_ }
+    , max_bytes{ max_bytes_ }
+    , num_bytes{ 0UL }
+    , entries{}
+    , index{}
+    , statistics{}
+{}
+
+
+bool  execution_cache::execute(std::function<void()> const&  executor)
+{
+    TMPROF_BLOCK();
+
+    if (max_bytes == 0UL)
+    {
+        executor();
+        return false;
+    }
+
+    ++statistics.lookups;
+
+    std::string  input;
+    {
+        iomodels::stdin_base const* const  stdin_ptr{ io.get_stdin() };
+        vecu8 const&  bytes{ stdin_ptr->get_bytes() };
+        input.assign(bytes.begin(), bytes.begin() + stdin_ptr->num_effective_bytes());
+    }
+
+    auto const  it = index.find(input);
+    if (it != index.end())
+    {
+        entries.splice(entries.begin(), entries, it->second);
+        io.restore_results(entries.front().results);
+        ++statistics.hits;
+        return true;
+    }
+
+    executor();
+
+    iomodels::iomanager::execution_results  results;
+    io.save_results(results);
+    std::size_t const  entry_bytes{ sizeof(entry) + input.size() + results.num_bytes() };
+    if (entry_bytes > max_bytes)
+    {
+        ++statistics.rejections;
+        return false;
+    }
+
+    while (num_bytes + entry_bytes > max_bytes)
+        evict_least_recently_used();
+
+    entries.push_front({ std::move(input), std::move(results), entry_bytes });
+    index.insert({ entries.front().input, entries.begin() });
+    num_bytes += entry_bytes;
+
+    ++statistics.insertions;
+    statistics.max_bytes = std::max(statistics.max_bytes, num_bytes);
+
+    return false;
+}
+
+
+void  execution_cache::clear()
+{
+    index.clear();
+    entries.clear();
+    num_bytes = 0UL;
+}
+
+
+void  execution_cache::evict_least_recently_used()
+{
+    INVARIANT(!entries.empty());
+
+    index.erase(entries.back().input);
+    num_bytes -= entries.back().num_bytes;
+    entries.pop_back();
+
+    ++statistics.evictions;
+}
+
+
+}
@@ -41,4 +41,40 @@ natural_64_bit  compute_hash(execution_path const&  path)
 }
 
 
+bool  is_same_record(branching_coverage_info const&  l, branching_coverage_info const&  r)
+{
+    return l.id == r.id &&
+           l.direction == r.direction &&
+           l.value == r.value &&
+           l.idx_to_br_instr == r.idx_to_br_instr &&
+           l.xor_like_branching_function == r.xor_like_branching_function &&
+           l.predicate == r.predicate &&
+           l.num_input_bytes == r.num_input_bytes;
+}
+
+
+bool  is_same_record(br_instr_coverage_info const&  l, br_instr_coverage_info const&  r)
+{
+    return l.br_instr_id == r.br_instr_id && l.covered_branch == r.covered_branch;
+}
+
+
+natural_64_bit  compute_hash(branching_coverage_info const&  info)
+{
+    natural_64_bit  result{ info.id.uid };
+    hash_combine(result, info.value);
+    hash_combine(result, (natural_64_bit)info.idx_to_br_instr);
+    hash_combine(result, (natural_64_bit)(info.direction ? 1033UL : 7919UL));
+    return result;
+}
+
+
+natural_64_bit  compute_hash(br_instr_coverage_info const&  info)
+{
+    natural_64_bit  result{ info.br_instr_id.uid };
+    hash_combine(result, (natural_64_bit)(info.covered_branch ? 1033UL : 7919UL));
+    return result;
+}
+
+
 }
@@ -13,6 +13,7 @@ namespace  fuzzing {
 fuzzer::coverage_progress_control_props::coverage_progress_control_props(fuzzer* const  fuzzer_ptr_)
     : fuzzer_ptr{ fuzzer_ptr_ }
     , phase_start_time{ fuzzer_ptr->get_elapsed_seconds() }
+    , phase_start_execution{ fuzzer_ptr->num_driver_executions }
     , num_covered_branchings{ 0U }
     , interrupted_state{ BITFLIP }
 {}
@@ -23,10 +24,10 @@ void  fuzzer::coverage_progress_control_props::interruption_enter()
     switch (fuzzer_ptr->state)
     {
         case BITSHARE:
-            recorder().on_bitshare_stop(progress_recorder::STOP::INTERRUPTED);
+            fuzzer_ptr->recorder().on_bitshare_stop(progress_recorder::STOP::INTERRUPTED);
             break;
         case LOCAL_SEARCH:
-            recorder().on_local_search_stop(progress_recorder::STOP::INTERRUPTED);
+            fuzzer_ptr->recorder().on_local_search_stop(progress_recorder::STOP::INTERRUPTED);
             break;
         default: { UNREACHABLE(); break; }
     }
@@ -34,7 +35,7 @@ void  fuzzer::coverage_progress_control_props::interruption_enter()
     interrupted_state = fuzzer_ptr->state;
     fuzzer_ptr->state = BITFLIP;
 
-    recorder().on_bitflip_start(fuzzer_ptr->bitflip.get_node(), progress_recorder::START::REGULAR);
+    fuzzer_ptr->recorder().on_bitflip_start(fuzzer_ptr->bitflip.get_node(), progress_recorder::START::REGULAR);
 }
 
 
@@ -43,14 +44,14 @@ void  fuzzer::coverage_progress_control_props::interruption_exit()
     fuzzer_ptr->state = interrupted_state;
     interrupted_state = BITFLIP;
 
-    recorder().on_bitflip_stop(progress_recorder::STOP::REGULAR);
+    fuzzer_ptr->recorder().on_bitflip_stop(progress_recorder::STOP::REGULAR);
     switch (fuzzer_ptr->state)
     {
         case BITSHARE:
-            recorder().on_bitshare_start(fuzzer_ptr->bitshare.get_node(), progress_recorder::START::RESUMED);
+            fuzzer_ptr->recorder().on_bitshare_start(fuzzer_ptr->bitshare.get_node(), progress_recorder::START::RESUMED);
             break;
         case LOCAL_SEARCH:
-            recorder().on_local_search_start(fuzzer_ptr->local_search.get_node(), progress_recorder::START::RESUMED);
+            fuzzer_ptr->recorder().on_local_search_start(fuzzer_ptr->active_local_search_slot().local_search.get_node(), progress_recorder::START::RESUMED);
             break;
         default: { UNREACHABLE(); break; }
     }
@@ -60,21 +61,24 @@ void  fuzzer::coverage_progress_control_props::interruption_exit()
 fuzzer::primary_coverage_target_branchings::primary_coverage_target_branchings(
         std::function<bool(location_id)> const&  is_covered_,
         std::function<branching_node*(location_id)> const&  iid_pivot_with_lowest_abs_value_,
-        performance_statistics* const  statistics_ptr_
+        loop_detection_cache* const  loop_detection_ptr_,
+        performance_statistics* const  statistics_ptr_,
+        progress_recorder* const  recorder_ptr_,
+        natural_32_bit const  num_locations
         )
     : loop_heads_sensitive{}
     , loop_heads_others{}
-    , sensitive{}
-    , untouched{}
+    , sensitive{ num_locations, &fuzzer::get_input_width_class }
+    , untouched{ num_locations, &fuzzer::get_input_width_class }
     , iid_twins_sensitive{}
     , iid_twins_others{}
-    , sensitive_counts{}
-    , untouched_counts{}
     , sensitive_start_index{ 0U }
     , untouched_start_index{ 0U }
     , is_covered{ is_covered_ }
     , iid_pivot_with_lowest_abs_value{ iid_pivot_with_lowest_abs_value_ }
+    , loop_detection{ loop_detection_ptr_ }
     , statistics{ statistics_ptr_ }
+    , recorder{ recorder_ptr_ }
 {}
 
 
@@ -85,8 +89,8 @@ void  fuzzer::primary_coverage_target_branchings::collect_loop_heads_along_path_
         for (natural_32_bit  input_width : get_input_width_classes())
             input_class_coverage.insert({ input_width, { false, nullptr } });
 
-        std::unordered_map<location_id, std::unordered_set<location_id> >  loop_heads_to_bodies;
-        detect_loops_along_path_to_node(end_node, loop_heads_to_bodies, nullptr);
+        loop_detection_cache::loop_heads_to_bodies_map  loop_heads_to_bodies;
+        loop_detection->compute_loop_heads_to_bodies(end_node, loop_heads_to_bodies);
 
         for (branching_node*  node = end_node; node != nullptr; node = node->get_predecessor())
             if (loop_heads_to_bodies.contains(node->get_location_id()))
@@ -139,7 +143,7 @@ void  fuzzer::primary_coverage_target_branchings::process_potential_coverage_tar
         if (node->was_sensitivity_performed())
         {
             if (!node->get_sensitive_stdin_bits().empty() && !node->was_local_search_performed())
-                sensitive.insert(node_and_flag);
+                sensitive.insert(node, flag);
         }
         else
         {
@@ -156,7 +160,7 @@ void  fuzzer::primary_coverage_target_branchings::process_potential_coverage_tar
                 }
             }
             else
-                untouched.insert(node_and_flag);
+                untouched.insert(node, flag);
         }
     }
 }
@@ -178,6 +182,14 @@ void  fuzzer::primary_coverage_target_branchings::erase(branching_node* const  n
 }
 
 
+void  fuzzer::primary_coverage_target_branchings::update(branching_node* const  node)
+{
+    ASSUMPTION(node != nullptr);
+    // Nodes in 'untouched' are not ranked by sensitive bits; 'do_cleanup' moves them to 'sensitive'.
+    sensitive.update(node);
+}
+
+
 bool  fuzzer::primary_coverage_target_branchings::empty() const
 {
     return  loop_heads_sensitive.empty() && loop_heads_others.empty() &&
@@ -201,7 +213,7 @@ void  fuzzer::primary_coverage_target_branchings::do_cleanup()
 {
     TMPROF_BLOCK();
 
-    std::unordered_set<branching_node*>  loop_heads;
+    branching_node_set  loop_heads;
     loop_heads.swap(loop_heads_sensitive);
     loop_heads.insert(loop_heads_others.begin(), loop_heads_others.end());
     loop_heads_others.clear();
@@ -214,10 +226,26 @@ void  fuzzer::primary_coverage_target_branchings::do_cleanup()
                 loop_heads_others.insert(node);
         }
 
-    std::unordered_map<branching_node*, bool>  work_set;
-    work_set.swap(sensitive);
-    work_set.insert(untouched.begin(), untouched.end());
-    untouched.clear();
+    // Targets staying in their queue keep their place there; only the others are
+    // removed and processed again (they may also get to the other queue).
+    branching_node_map<bool>  work_set;
+    for (auto targets : { &sensitive, &untouched })
+        targets->for_each([this, targets, &work_set](branching_node* const  node, bool const  flag) {
+                if (!node->is_pending() || is_covered(node->get_location_id()))
+                    work_set.insert({ node, flag });
+                else if (node->was_sensitivity_performed())
+                {
+                    if (targets != &sensitive || node->get_sensitive_stdin_bits().empty() || node->was_local_search_performed())
+                        work_set.insert({ node, flag });
+                }
+                else if (targets != &untouched || iid_pivot_with_lowest_abs_value(node->get_location_id()) != nullptr)
+                    work_set.insert({ node, flag });
+                });
+    for (auto const&  node_and_flag : work_set)
+    {
+        sensitive.erase(node_and_flag.first);
+        untouched.erase(node_and_flag.first);
+    }
     for (auto iid_twins : { &iid_twins_sensitive, &iid_twins_others })
         for (auto const&  loc_and_props : *iid_twins)
             work_set.insert(loc_and_props.second);
@@ -243,17 +271,16 @@ branching_node*  fuzzer::primary_coverage_target_branchings::get_best_others(nat
             {
                 best_node = *loop_heads_others.begin();
                 ++statistics->strategy_loop_head_others;
-                recorder().on_strategy_turn_loop_head_others();
+                recorder->on_strategy_turn_loop_head_others();
             }
             return best_node;
         },
         [this, max_input_width](){
-            branching_node*  best_node{ get_best(untouched, untouched_counts, max_input_width) };
+            branching_node*  best_node{ get_best(untouched, max_input_width) };
             if (best_node != nullptr)
             {
-                ++untouched_counts.at(best_node->get_location_id().id);
                 ++statistics->strategy_untouched;
-                recorder().on_strategy_turn_untouched();
+                recorder->on_strategy_turn_untouched();
             }
             return best_node;
         }
@@ -278,7 +305,7 @@ branching_node*  fuzzer::primary_coverage_target_branchings::get_best_others(nat
                 return get_best_others(max_input_width);
         }
         ++statistics->strategy_iid_twins_others;
-        recorder().on_strategy_turn_iid_twins_others();
+        recorder->on_strategy_turn_iid_twins_others();
         return it->second.first;
     }
 
@@ -286,159 +313,112 @@ branching_node*  fuzzer::primary_coverage_target_branchings::get_best_others(nat
 }
 
 
-branching_node*  fuzzer::primary_coverage_target_branchings::get_best_sensitive(natural_32_bit const  max_input_width)
+branching_node*  fuzzer::primary_coverage_target_branchings::get_best_sensitive(
+        natural_32_bit const  max_input_width,
+        std::function<bool(branching_node*)> const&  accept
+        )
 {
     TMPROF_BLOCK();
 
+    bool  rejected{ false };
+    auto const  is_accepted = [&accept, &rejected](branching_node* const  node) {
+        if (accept(node))
+            return true;
+        rejected = true;
+        return false;
+    };
+
     std::vector<std::function<branching_node*()> > const  best_node_getters {
-        [this](){
+        [this, &is_accepted](){
             branching_node*  best_node = nullptr;
-            if (!loop_heads_sensitive.empty())
+            if (!loop_heads_sensitive.empty() && is_accepted(*loop_heads_sensitive.begin()))
             {
                 best_node = *loop_heads_sensitive.begin();
                 ++statistics->strategy_loop_head_sensitive;
-                recorder().on_strategy_turn_loop_head_sensitive();
+                recorder->on_strategy_turn_loop_head_sensitive();
             }
             return best_node;
         },
-        [this, max_input_width](){
-            branching_node*  best_node{ get_best(sensitive, sensitive_counts, max_input_width) };
+        [this, max_input_width, &is_accepted](){
+            branching_node*  best_node{ sensitive.get_best(max_input_width) };
+            if (best_node != nullptr && !is_accepted(best_node))
+                best_node = nullptr;
             if (best_node != nullptr)
             {
-                ++sensitive_counts.at(best_node->get_location_id().id);
+                select(sensitive, best_node);
                 ++statistics->strategy_sensitive;
-                recorder().on_strategy_turn_sensitive();
+                recorder->on_strategy_turn_sensitive();
             }
             return best_node;
         }
     };
-    sensitive_start_index = (sensitive_start_index + 1U) % best_node_getters.size();
+    // A call which rejected all candidates does not move the start index.
+    natural_32_bit const  start_index = (sensitive_start_index + 1U) % best_node_getters.size();
     for (std::size_t  i = 0UL; i != best_node_getters.size(); ++i)
     {
-        std::size_t  idx = (sensitive_start_index + i) % best_node_getters.size();
+        std::size_t  idx = (start_index + i) % best_node_getters.size();
         branching_node* const  best_node{ best_node_getters.at(idx)() };
         if (best_node != nullptr)
+        {
+            sensitive_start_index = start_index;
             return best_node;
+        }
     }
 
-    if (!iid_twins_sensitive.empty())
+    if (!iid_twins_sensitive.empty() && is_accepted(iid_twins_sensitive.begin()->second.first))
     {
+        sensitive_start_index = start_index;
         auto const  it = iid_twins_sensitive.begin();
         if (!it->second.second) 
         {
             collect_loop_heads_along_path_to_node(it->second.first);
             it->second.second = true;
             if (!loop_heads_sensitive.empty())
-                return get_best_sensitive(max_input_width);
+                return get_best_sensitive(max_input_width, accept);
         }
         ++statistics->strategy_iid_twins_sensitive;
-        recorder().on_strategy_turn_iid_twins_sensitive();
+        recorder->on_strategy_turn_iid_twins_sensitive();
         return it->second.first;
     }
 
+    if (!rejected)
+        sensitive_start_index = start_index;
     return nullptr;
 }
 
 
-void  fuzzer::primary_coverage_target_branchings::update_counts(
-        std::unordered_map<location_id::id_type, natural_32_bit>&  counts,
-        std::unordered_map<branching_node*, bool> const&  data
-        )
-{
-    std::unordered_map<location_id::id_type, natural_32_bit>  old_counts;
-    old_counts.swap(counts);
-    natural_32_bit  min_count{ 0U };
-    for (auto const&  id_and_count : old_counts)
-        min_count = std::min(min_count, id_and_count.second);
-    for (auto const&  node_and_bool : data)
-    {
-        auto const  it = old_counts.find(node_and_bool.first->get_location_id().id);
-        counts[node_and_bool.first->get_location_id().id] = it == old_counts.end() ? 0U : it->second - min_count;
-    }
-}
-
-
 branching_node*  fuzzer::primary_coverage_target_branchings::get_best(
-        std::unordered_map<branching_node*, bool>&  targets,
-        std::unordered_map<location_id::id_type, natural_32_bit>&  counts,
+        coverage_target_queue&  targets,
         natural_32_bit const  max_input_width
         )
 {
-    if (targets.empty())
-        return nullptr;
-
-    struct  branching_node_with_less_than
-    {
-        branching_node_with_less_than(
-                branching_node* const  node_,
-                natural_32_bit const  count_,
-                natural_32_bit const  max_input_width
-                )
-            : node{ node_ }
-            , count{ count_ }
-            , distance_to_central_input_width_class{
-                    std::abs((integer_32_bit)get_input_width_class(max_input_width / 2U) -
-                             (integer_32_bit)get_input_width_class(node->get_num_stdin_bytes()))
-                    }
-        {}
-        operator  branching_node*() const { return node; }
-        bool  operator<(branching_node_with_less_than const&  other) const
-        {
-            if (count < other.count)
-                return true;
-            if (count > other.count)
-                return false;
-            if (node->get_sensitive_stdin_bits().size() < other.node->get_sensitive_stdin_bits().size())
-                return true;
-            if (node->get_sensitive_stdin_bits().size() > other.node->get_sensitive_stdin_bits().size())
-                return false;
-            if (distance_to_central_input_width_class < other.distance_to_central_input_width_class)
-                return true;
-            if (distance_to_central_input_width_class > other.distance_to_central_input_width_class)
-                return false;
-            if (node->get_num_stdin_bytes() < other.node->get_num_stdin_bytes())
-                return true;
-            if (node->get_num_stdin_bytes() > other.node->get_num_stdin_bytes())
-                return false;
-            if (node->get_trace_index() < other.node->get_trace_index())
-                return true;
-            if (node->get_trace_index() > other.node->get_trace_index())
-                return false;
-            return node->get_max_successors_trace_index() > other.node->get_max_successors_trace_index();
-        }
-    private:
-        branching_node*  node;
-        natural_32_bit  count;
-        integer_32_bit  distance_to_central_input_width_class;
-    };
+    branching_node* const  best{ targets.get_best(max_input_width) };
+    if (best != nullptr)
+        select(targets, best);
+    return best;
+}
 
-    update_counts(counts, targets);
 
-    branching_node_with_less_than  best{ targets.begin()->first, counts.at(targets.begin()->first->get_location_id().id), max_input_width };
-    for (auto  it = std::next(targets.begin()); it != targets.end(); ++it)
-    {
-        branching_node_with_less_than const  current{ it->first, counts.at(it->first->get_location_id().id), max_input_width };
-        if (current < best)
-            best = current;
-    }
-
-    auto const  it = targets.find(best);
-    if (!it->second)
+void  fuzzer::primary_coverage_target_branchings::select(coverage_target_queue&  targets, branching_node* const  node)
+{
+    if (!targets.get_flag(node))
     {
-        collect_loop_heads_along_path_to_node(it->first);
-        it->second = true;
+        collect_loop_heads_along_path_to_node(node);
+        targets.set_flag(node);
     }
-
-    return best;
+    targets.increment_count(node);
 }
 
 
-fuzzer::input_flow_analysis_thread::input_flow_analysis_thread(sala::Program const* sala_program_ptr)
+fuzzer::input_flow_analysis_thread::input_flow_analysis_thread(
+        sala::Program const* sala_program_ptr,
+        iomodels::iomanager const&  io
+        )
     : state{ READY }
     , io_setup{
-            iomodels::iomanager::instance().clone_stdin(),
-            iomodels::iomanager::instance().clone_stdout(),
-            iomodels::iomanager::instance().get_config()
+            io.clone_stdin(),
+            io.clone_stdout(),
+            io.get_config()
             }
     , request{}
     , input_flow{ sala_program_ptr, &io_setup }
@@ -487,7 +467,7 @@ void  fuzzer::input_flow_analysis_thread::start(
     std::lock_guard<std::mutex> const lock(mutex);
 
     request.data.input_ptr = node_ptr->get_best_stdin();
-    request.data.trace_ptr = node_ptr->get_best_trace();
+    request.data.trace = node_ptr->get_best_trace();
     request.data.trace_size = node_ptr->get_trace_index() + 1U;
     request.data.sensitive_bits.clear();
     request.changed_nodes.clear();
@@ -511,6 +491,16 @@ void  fuzzer::input_flow_analysis_thread::stop()
 }
 
 
+void  fuzzer::input_flow_analysis_thread::wait_until_finished() const
+{
+    while (is_busy())
+    {
+        using namespace std::chrono_literals;
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
+
 branching_node*  fuzzer::input_flow_analysis_thread::get_node() const
 {
     ASSUMPTION(is_ready());
@@ -518,7 +508,7 @@ branching_node*  fuzzer::input_flow_analysis_thread::get_node() const
 }
 
 
-std::unordered_set<branching_node*> const&  fuzzer::input_flow_analysis_thread::get_changed_nodes()
+branching_node_set const&  fuzzer::input_flow_analysis_thread::get_changed_nodes()
 {
     ASSUMPTION(is_ready());
     return request.changed_nodes;
@@ -538,15 +528,14 @@ void  fuzzer::input_flow_analysis_thread::apply_results(branching_node* const  e
     {
         ASSUMPTION(node->get_trace_index() == trace_index);
 
-        auto const&  info{ request.data.trace_ptr->at(trace_index) };
+        auto const&  info{ request.data.trace.at(trace_index) };
         if (node->get_location_id() != info.id)
             break;
 
         request.last_node = node;
         if (trace_index < request.data.sensitive_bits.size())
-            for (auto const  bit_idx : request.data.sensitive_bits.at(trace_index))
-                if (node->insert_sensitive_stdin_bit(bit_idx))
-                    request.changed_nodes.insert(node);
+            if (node->insert_sensitive_stdin_bits(request.data.sensitive_bits.at(trace_index)))
+                request.changed_nodes.insert(node);
         if (!node->was_sensitivity_performed())
             request.changed_nodes.insert(node);
 
@@ -621,46 +610,122 @@ void fuzzer::input_flow_analysis_thread::worker_thread_procedure()
 }
 
 
-void  fuzzer::histogram_of_hit_counts_per_direction::merge(
-        histogram_of_hit_counts_per_direction const*  histogram,
-        histogram_of_hit_counts_per_direction const* const  end,
-        hit_counts_map&  result
-        )
+fuzzer::hit_count_per_direction&  fuzzer::histogram_of_hit_counts_per_direction::at_last_version(location_id::id_type const  id)
 {
-    for ( ; histogram != end; histogram = histogram->get_predecessor().get())
-        result.insert(histogram->hit_counts.begin(), histogram->hit_counts.end());
+    ASSUMPTION(!changes.empty());
+    version_type const  version{ num_versions() - 1U };
+    std::vector<version_and_counts>&  counts{ history[id] };
+    if (counts.empty() || counts.back().first != version)
+    {
+        counts.push_back({ version, counts.empty() ? hit_count_per_direction{} : counts.back().second });
+        changes.back().push_back(id);
+    }
+    return counts.back().second;
 }
 
 
-fuzzer::probability_generator_all_then_all::probability_generator_all_then_all(
-        float_32_bit const  false_direction_probability_,
-        natural_32_bit const  total_num_samples_,
-        bool const  first_direction_
+fuzzer::hit_count_per_direction const*  fuzzer::histogram_of_hit_counts_per_direction::find(
+        location_id::id_type const  id,
+        version_type const  version
+        ) const
+{
+    std::vector<version_and_counts> const* const  counts{ history.find(id) };
+    if (counts == nullptr)
+        return nullptr;
+    auto const  it = std::upper_bound(
+            counts->begin(),
+            counts->end(),
+            version,
+            [](version_type const  v, version_and_counts const&  entry) { return v < entry.first; }
+            );
+    return it == counts->begin() ? nullptr : &std::prev(it)->second;
+}
+
+
+std::size_t  fuzzer::histogram_of_hit_counts_per_direction::get_memory_bytes() const
+{
+    std::size_t  num_bytes{ sizeof(histogram_of_hit_counts_per_direction) + history.num_slots() * sizeof(std::vector<version_and_counts>) };
+    // Each change of a location in a version is also one entry in the history of the location.
+    for (auto const&  ids : changes)
+        num_bytes += sizeof(ids) + ids.capacity() * sizeof(location_id::id_type) + ids.size() * sizeof(version_and_counts);
+    return num_bytes;
+}
+
+
+void  fuzzer::histogram_of_hit_counts_per_direction::count_memory_bytes()
+{
+    std::size_t const  num_bytes{ get_memory_bytes() };
+    *live_bytes += num_bytes;
+    *live_bytes -= counted_bytes;
+    counted_bytes = num_bytes;
+}
+
+
+fuzzer::monte_carlo_sampling_table::monte_carlo_sampling_table(random_generator_for_natural_32_bit&  uniform_generator_)
+    : locations{}
+    , samplers{}
+    , uniform_generator{ uniform_generator_ }
+{}
+
+
+void  fuzzer::monte_carlo_sampling_table::insert(
+        location_id::id_type const  id,
+        float_32_bit const  false_direction_probability,
+        SAMPLING const  sampling,
+        natural_32_bit const  total_num_samples
         )
-    : samples_total{
-            (natural_32_bit)(false_direction_probability_ * (float_32_bit)total_num_samples_ + 0.5f),
-            total_num_samples_ - samples_total[0]
-            }
-    , samples_consumed{ 0U, 0U }
-    , direction{ first_direction_}
 {
-    ASSUMPTION(false_direction_probability_ >= 0.0f && false_direction_probability_ <= 1.0f && total_num_samples_ >= 1U);
-    INVARIANT(samples_total[0] > 0 || samples_total[1] > 0);
+    location_props&  props{ locations[id] };
+    props.false_direction_probability = false_direction_probability;
+    switch (sampling)
+    {
+        case UNIFORM:
+            props.sampler_index = UNIFORM_SAMPLER;
+            break;
+        case ALL_FALSE_THEN_ALL_TRUE:
+        case ALL_TRUE_THEN_ALL_FALSE:
+        {
+            ASSUMPTION(false_direction_probability >= 0.0f && false_direction_probability <= 1.0f && total_num_samples >= 1U);
+            natural_32_bit const  num_false_samples{ (natural_32_bit)(false_direction_probability * (float_32_bit)total_num_samples + 0.5f) };
+            props.sampler_index = (natural_32_bit)samplers.size();
+            samplers.push_back({
+                    .samples_total = { num_false_samples, total_num_samples - num_false_samples },
+                    .samples_consumed = { 0U, 0U },
+                    .direction = sampling == ALL_TRUE_THEN_ALL_FALSE
+                    });
+            INVARIANT(samplers.back().samples_total[0] > 0 || samplers.back().samples_total[1] > 0);
+            break;
+        }
+        default: { UNREACHABLE(); break; }
+    }
+}
+
+
+bool  fuzzer::monte_carlo_sampling_table::sample_direction(location_id::id_type const  id)
+{
+    location_props const* const  props{ locations.find(id) };
+    if (props == nullptr)
+        return get_random_float_32_bit_in_range(0.0f, 1.0f, uniform_generator) <= 0.5f ? false : true;
+    return next_sample(props->sampler_index) <= props->false_direction_probability ? false : true;
 }
 
 
-float_32_bit  fuzzer::probability_generator_all_then_all::next()
+float_32_bit  fuzzer::monte_carlo_sampling_table::next_sample(natural_32_bit const  sampler_index)
 {
+    if (sampler_index == UNIFORM_SAMPLER)
+        return get_random_float_32_bit_in_range(0.0f, 1.0f, uniform_generator);
+
+    all_then_all_sampler&  sampler{ samplers[sampler_index] };
     while (true)
     {
-        int const  index = direction ? 1 : 0;
-        if (samples_consumed[index] < samples_total[index])
+        int const  index = sampler.direction ? 1 : 0;
+        if (sampler.samples_consumed[index] < sampler.samples_total[index])
         {
-            ++samples_consumed[index];
-            return direction ? 1.0f : 0.0f;
+            ++sampler.samples_consumed[index];
+            return sampler.direction ? 1.0f : 0.0f;
         }
-        samples_consumed[index] = 0U;
-        direction = !direction;
+        sampler.samples_consumed[index] = 0U;
+        sampler.direction = !sampler.direction;
     }
 }
 
@@ -828,8 +893,8 @@ void  fuzzer::compute_loop_boundaries(
 }
 
 
-std::unordered_map<branching_node*, fuzzer::iid_pivot_props>::const_iterator  fuzzer::select_best_iid_pivot(
-        std::unordered_map<branching_node*, iid_pivot_props> const&  pivots,
+branching_node_map<fuzzer::iid_pivot_props>::const_iterator  fuzzer::select_best_iid_pivot(
+        branching_node_map<iid_pivot_props> const&  pivots,
         natural_32_bit const  max_input_width,
         random_generator_for_natural_32_bit&  random_generator,
         float_32_bit const  LIMIT_STEP
@@ -865,7 +930,12 @@ std::unordered_map<branching_node*, fuzzer::iid_pivot_props>::const_iterator  fu
             if (pivot->get_num_stdin_bytes() > other.pivot->get_num_stdin_bytes())
                 return false;
 
-            return pivot->get_trace_index() < other.pivot->get_trace_index();
+            if (pivot->get_trace_index() < other.pivot->get_trace_index())
+                return true;
+            if (pivot->get_trace_index() > other.pivot->get_trace_index())
+                return false;
+
+            return pivot->guid() < other.pivot->guid();
         }
         branching_node*  pivot;
         branching_function_value_type  abs_value;
@@ -888,7 +958,7 @@ std::unordered_map<branching_node*, fuzzer::iid_pivot_props>::const_iterator  fu
 void  fuzzer::compute_histogram_of_false_direction_probabilities(
         natural_32_bit const  input_width,
         std::unordered_set<location_id> const&  pure_loop_bodies,
-        std::unordered_map<branching_node*, iid_pivot_props> const&  pivots,
+        branching_node_map<iid_pivot_props> const&  pivots,
         histogram_of_false_direction_probabilities&  histogram
         )
 {
@@ -896,25 +966,30 @@ void  fuzzer::compute_histogram_of_false_direction_probabilities(
 
     std::unordered_map<location_id::id_type, std::multimap<branching_function_value_type, float_32_bit> > hist_pack;
     {
-        std::unordered_set<histogram_of_hit_counts_per_direction const*>  processed_histograms;
+        // Pivots share the versions of their histograms; each version is processed only once,
+        // i.e. for the first pivot containing it. The versions processed so far always form
+        // a prefix, so we keep only the number of processed versions per histogram.
+        std::unordered_map<histogram_of_hit_counts_per_direction const*, histogram_of_hit_counts_per_direction::version_type>  num_processed_versions;
         for (auto  it = pivots.begin(); it != pivots.end(); ++it)
             if (it->first->get_num_stdin_bytes() == input_width)
-                for (histogram_of_hit_counts_per_direction const*  hist_ptr = it->second.histogram_ptr.get();
-                            hist_ptr != nullptr && processed_histograms.insert(hist_ptr).second;
-                            hist_ptr = hist_ptr->get_predecessor().get())
-                    for (auto const& id_and_hits : hist_ptr->local_hit_counts())
+            {
+                histogram_of_hit_counts_per_direction const&  hist{ *it->second.histogram_ptr };
+                auto&  num_processed{ num_processed_versions[&hist] };
+                for (auto  version = it->second.histogram_version + 1U; version > num_processed; --version)
+                    for (location_id::id_type const  id : hist.changed_locations(version - 1U))
                     {
-                        auto const&  hit_count = id_and_hits.second.hit_count;
+                        auto const&  hit_count = hist.find(id, version - 1U)->hit_count;
                         INVARIANT(hit_count[false] != 0U || hit_count[true] != 0U);
                         float_64_bit const  false_direction_probability {
                                 (float_64_bit)hit_count[false] / ((float_64_bit)hit_count[false] + (float_64_bit)hit_count[true])
                                 };
-                        hist_pack[id_and_hits.first].insert({
+                        hist_pack[id].insert({
                                 std::fabs(it->first->get_best_value()),
                                 (float_32_bit)false_direction_probability
                                 });
                     }
-
+                num_processed = std::max(num_processed, it->second.histogram_version + 1U);
+            }
     }
 
     for (auto const&  id_and_pack : hist_pack)
@@ -968,57 +1043,39 @@ branching_node*  fuzzer::select_start_node_for_monte_carlo_search(
 }
 
 
-std::shared_ptr<fuzzer::probability_generator_random_uniform>  fuzzer::compute_probability_generators_for_locations(
+void  fuzzer::compute_monte_carlo_sampling_table(
         histogram_of_false_direction_probabilities const&  probabilities,
-        histogram_of_hit_counts_per_direction::hit_counts_map const&  hit_counts,
+        histogram_of_hit_counts_per_direction const&  hit_counts,
+        histogram_of_hit_counts_per_direction::version_type const  hit_counts_version,
         std::unordered_set<location_id> const&  pure_loop_bodies,
-        probability_generators_for_locations&  generators,
-        random_generator_for_natural_32_bit&  generator_for_generator_selection,
-        random_generator_for_natural_32_bit&  generator_for_generators
+        monte_carlo_sampling_table&  table,
+        random_generator_for_natural_32_bit&  generator_for_sampling_selection
         )
 {
-    std::shared_ptr<probability_generator_random_uniform> const  random_uniform_generator{
-            std::make_shared<probability_generator_random_uniform>(generator_for_generators)
-            };
-
     for (auto const&  id_and_probability : probabilities)
         if (pure_loop_bodies.contains(id_and_probability.first))
         {
-            switch (get_random_integer_32_bit_in_range(0, 2, generator_for_generator_selection))
+            natural_32_bit const  total_num_samples{ hit_counts.find(id_and_probability.first, hit_counts_version)->total() };
+            switch (get_random_integer_32_bit_in_range(0, 2, generator_for_sampling_selection))
             {
                 case 0:
-                    generators[id_and_probability.first] = random_uniform_generator;
+                    table.insert(id_and_probability.first, id_and_probability.second, monte_carlo_sampling_table::UNIFORM, total_num_samples);
                     break;
                 case 1:
-                    generators[id_and_probability.first] = std::make_shared<probability_generator_all_then_all>(
-                            id_and_probability.second,
-                            hit_counts.at(id_and_probability.first).total(),
-                            false
-                            );
+                    table.insert(id_and_probability.first, id_and_probability.second, monte_carlo_sampling_table::ALL_FALSE_THEN_ALL_TRUE, total_num_samples);
                     break;
                 case 2:
-                    generators[id_and_probability.first] = std::make_shared<probability_generator_all_then_all>(
-                            id_and_probability.second,
-                            hit_counts.at(id_and_probability.first).total(),
-                            true
-                            );
+                    table.insert(id_and_probability.first, id_and_probability.second, monte_carlo_sampling_table::ALL_TRUE_THEN_ALL_FALSE, total_num_samples);
                     break;
                 default: UNREACHABLE(); break;
             }
         }
         else
-            generators[id_and_probability.first] = random_uniform_generator;
-
-    return random_uniform_generator;    
+            table.insert(id_and_probability.first, id_and_probability.second, monte_carlo_sampling_table::UNIFORM, 0U);
 }
 
 
-branching_node*  fuzzer::monte_carlo_search(
-        branching_node* const  start_node,
-        histogram_of_false_direction_probabilities const&  histogram,
-        probability_generators_for_locations const&  generators,
-        probability_generator_random_uniform&  location_miss_generator
-        )
+branching_node*  fuzzer::monte_carlo_search(branching_node* const  start_node, monte_carlo_sampling_table&  table)
 {
     TMPROF_BLOCK();
 
@@ -1027,7 +1084,7 @@ branching_node*  fuzzer::monte_carlo_search(
     branching_node*  pivot = start_node;
     while (true)
     {
-        branching_node* const  successor{ monte_carlo_step(pivot, histogram, generators, location_miss_generator) };
+        branching_node* const  successor{ monte_carlo_step(pivot, table) };
         if (successor == nullptr)
             break;
         pivot = successor;
@@ -1042,9 +1099,7 @@ branching_node*  fuzzer::monte_carlo_search(
 std::pair<branching_node*, bool>  fuzzer::monte_carlo_backward_search(
         branching_node* const  start_node,
         branching_node* const  end_node,
-        histogram_of_false_direction_probabilities const&  histogram,
-        probability_generators_for_locations const&  generators,
-        probability_generator_random_uniform&  location_miss_generator
+        monte_carlo_sampling_table&  table
         )
 {
     TMPROF_BLOCK();
@@ -1060,7 +1115,7 @@ std::pair<branching_node*, bool>  fuzzer::monte_carlo_backward_search(
 
     while (pivot->get_predecessor() != end_node)
     {
-        branching_node* const  successor{ monte_carlo_step(pivot->get_predecessor(), histogram, generators, location_miss_generator) };
+        branching_node* const  successor{ monte_carlo_step(pivot->get_predecessor(), table) };
         if (successor != pivot)
             break;
         pivot = pivot->get_predecessor();
@@ -1070,12 +1125,7 @@ std::pair<branching_node*, bool>  fuzzer::monte_carlo_backward_search(
 }
 
 
-branching_node*  fuzzer::monte_carlo_step(
-        branching_node* const  pivot,
-        histogram_of_false_direction_probabilities const&  histogram,
-        probability_generators_for_locations const&  generators,
-        probability_generator_random_uniform&  location_miss_generator
-        )
+branching_node*  fuzzer::monte_carlo_step(branching_node* const  pivot, monte_carlo_sampling_table&  table)
 {
     INVARIANT(pivot != nullptr && !pivot->is_closed());
 
@@ -1087,20 +1137,7 @@ branching_node*  fuzzer::monte_carlo_step(
     bool const  can_go_left = left != nullptr && !left->is_closed();
     bool const  can_go_right = right != nullptr && !right->is_closed();
 
-    bool  desired_direction;
-    {
-        float_32_bit  false_direction_probability;
-        {
-            auto const  it = histogram.find(pivot->get_location_id().id);
-            false_direction_probability = it != histogram.end() ? it->second : 0.5f;
-        }
-        float_32_bit  probability;
-        {
-            auto const  it = generators.find(pivot->get_location_id().id);
-            probability = it != generators.end() ? it->second->next() : location_miss_generator.next();
-        }
-        desired_direction = probability <= false_direction_probability ? false : true;
-    }
+    bool const  desired_direction{ table.sample_direction(pivot->get_location_id().id) };
 
     bool const can_go_desired_direction = (desired_direction == false && can_go_left) || (desired_direction == true && can_go_right);
 
@@ -1113,51 +1150,89 @@ branching_node*  fuzzer::monte_carlo_step(
 }
 
 
-fuzzer::fuzzer(termination_info const&  info, sala::Program const* const sala_program_ptr_)
-    : sala_program_ptr{ sala_program_ptr_ }
+fuzzer::fuzzer(
+        campaign_context&  context_,
+        termination_info const&  info,
+        sala::Program const* const sala_program_ptr_,
+        target_metadata const&  metadata
+        )
+    : context{ context_ }
+    , sala_program_ptr{ sala_program_ptr_ }
 
     , termination_props{ info }
+    , target_props{ metadata }
 
     , num_driver_executions{ 0U }
     , time_point_start{ std::chrono::steady_clock::now() }
     , time_point_current{ time_point_start }
 
+    , stdin_pool{
+            [](stdin_bits_and_types&  bits_and_types) { bits_and_types.clear(); },
+            [](stdin_bits_and_types const&  bits_and_types) {
+                    return sizeof(stdin_bits_and_types)
+                         + bits_and_types.bits.num_bytes()
+                         + bits_and_types.types.size() * (sizeof(stdin_bits_and_types::type_of_input_bits) + sizeof(natural_32_bit));
+                    }
+            }
+    , cmp_operands_pool{
+            [](cmp_operands_trace&  cmp_operands) { cmp_operands.clear(); },
+            [](cmp_operands_trace const&  cmp_operands) { return cmp_operands.size() * sizeof(cmp_operands_info); }
+            }
+    , stdin_bits_buffer{}
+    , raw_trace_buffer{}
+
     , entry_branching{}
     , leaf_branchings{}
 
-    , covered_branchings{}
-    , uncovered_branchings{}
+    , execution_traces{}
+    , br_instr_execution_traces{}
+
+    , coverage{ metadata.num_cond_locations }
     , branchings_to_crashes{}
 
+    , loop_detection{}
     , primary_coverage_targets{
-            [this](location_id const  id) { return covered_branchings.contains(id); },
+            [this](location_id const  id) { return coverage.is_covered(id); },
             [this](location_id const  loc_id) {
                     auto const  it = iid_pivots.find(loc_id);
                     return it == iid_pivots.end() ? nullptr : it->second.pivot_with_lowest_abs_value;
                     },
-            &statistics
+            &loop_detection,
+            &statistics,
+            &context.recorder,
+            metadata.num_cond_locations
             }
     , iid_pivots{}
+    , iid_histograms_bytes{ std::make_shared<std::size_t>(0UL) }
 
-    , dead_nodes_buffer{}
+    , change_events{}
     , coverage_failures_with_hope{}
 
     , state{ STARTUP }
     , coverage_control{ this }
-    , input_flow_thread{ sala_program_ptr }
-    , bitshare{}
-    , local_search{}
-    , bitflip{}
+    , input_flow_thread{ sala_program_ptr, context.io }
+    , rebuild_executor{}
+    , execution_cache_ptr{ nullptr }
+    , seed_inputs{}
+    , bitshare{ metadata.num_cond_locations, context.recorder }
+    , local_search_slots{}
+    , active_local_search_slot_index{ 0UL }
+    , bitflip{ context.recorder, info.random_seed }
 
     , max_input_width{ 0U }
 
-    , generator_for_iid_location_selection{ 1U }
-    , generator_for_iid_approach_selection{ 1U }
-    , generator_for_generator_selection{ 1U }
+    , generator_for_iid_location_selection{ info.random_seed }
+    , generator_for_iid_approach_selection{ info.random_seed }
+    , generator_for_generator_selection{ info.random_seed }
 
     , render_state{ RENDER_STATE::DISABLED }
     , statistics{}
-{}
+{
+    natural_32_bit const  num_local_search_slots{ std::max(info.max_local_searches, 1U) };
+    local_search_slots.reserve(num_local_search_slots);
+    while (local_search_slots.size() < num_local_search_slots)
+        local_search_slots.emplace_back(context.recorder, info.random_seed);
+}
 
 
 fuzzer::~fuzzer()
@@ -1166,6 +1241,31 @@ fuzzer::~fuzzer()
 }
 
 
+fuzzer::performance_statistics const&  fuzzer::get_fuzzer_statistics() const
+{
+    object_pool_statistics const  nodes{ branching_node::get_node_memory_statistics() };
+    object_pool_statistics const  data{ branching_node::get_analysis_data_memory_statistics() };
+    statistics.node_memory_live_bytes = (statistics.nodes_created - statistics.nodes_destroyed) * branching_node::get_memory_bytes_per_node();
+    statistics.node_memory_reserved_bytes = nodes.reserved_bytes + data.reserved_bytes;
+    statistics.node_memory_max_live_nodes = nodes.max_live_objects;
+    statistics.node_memory_fragmentation = statistics.node_memory_reserved_bytes == 0UL ? 0.0 :
+            1.0 - (float_64_bit)(nodes.live_bytes + data.live_bytes) / (float_64_bit)statistics.node_memory_reserved_bytes;
+    trace_store_statistics const  traces{ execution_traces.get_statistics() };
+    statistics.trace_chunks_created = traces.chunks_created;
+    statistics.trace_chunks_shared = traces.chunks_shared;
+    statistics.trace_chunks_indexed = traces.indexed_chunks;
+    statistics.loop_detection_queries = loop_detection.get_statistics().queries;
+    statistics.loop_detection_cached_nodes = loop_detection.size();
+    statistics.loop_detection_nodes_walked = loop_detection.get_statistics().nodes_walked;
+    statistics.buffer_acquisitions = stdin_pool.get_statistics().acquisitions + cmp_operands_pool.get_statistics().acquisitions;
+    statistics.buffer_allocations = stdin_pool.get_statistics().allocations + cmp_operands_pool.get_statistics().allocations;
+    statistics.buffer_allocations_per_execution = num_driver_executions == 0U ? 0.0 :
+            (float_64_bit)statistics.buffer_allocations / (float_64_bit)num_driver_executions;
+    measure_memory_usage();
+    return statistics;
+}
+
+
 void  fuzzer::terminate()
 {
     stop_all_analyzes();
@@ -1181,20 +1281,34 @@ void  fuzzer::stop_all_analyzes()
 {
     input_flow_thread.stop();
     bitshare.stop();
-    local_search.stop();
+    for (local_search_slot&  slot : local_search_slots)
+    {
+        slot.input_to_state.stop();
+        slot.local_search.stop();
+    }
     bitflip.stop();
 }
 
 
+void  fuzzer::set_seed_inputs(std::vector<vecu8> const&  inputs)
+{
+    ASSUMPTION(state == STARTUP && num_driver_executions == 0U);
+
+    seed_inputs.clear();
+    for (vecu8 const&  bytes : inputs)
+        seed_inputs.emplace_back(bytes);
+}
+
+
 bool  fuzzer::round_begin(TERMINATION_REASON&  termination_reason)
 {
     TMPROF_BLOCK();
 
-    iomodels::iomanager::instance().get_stdin()->clear();
-    iomodels::iomanager::instance().get_stdout()->clear();
+    context.io.get_stdin()->clear();
+    context.io.get_stdout()->clear();
 
-    vecb  stdin_bits;
-    if (!generate_next_input(stdin_bits, termination_reason))
+    stdin_bits_buffer.clear();
+    if (!generate_next_input(stdin_bits_buffer, termination_reason))
         return false;
     if (!can_make_progress())
     {
@@ -1202,9 +1316,7 @@ bool  fuzzer::round_begin(TERMINATION_REASON&  termination_reason)
         termination_reason = TERMINATION_REASON::FUZZING_STRATEGY_DEPLETED;
         return false;
     }
-    vecu8 stdin_bytes;
-    bits_to_bytes(stdin_bits, stdin_bytes);
-    iomodels::iomanager::instance().get_stdin()->set_bytes(stdin_bytes);
+    context.io.get_stdin()->set_bytes(stdin_bits_buffer.bytes());
 
     recorder().on_input_generated();
 
@@ -1218,13 +1330,23 @@ std::pair<execution_record::execution_flags, std::string const&>  fuzzer::round_
 
     execution_record::execution_flags const  flags = process_execution_results();
 
+    if (state == STARTUP && num_driver_executions > 0U)
+    {
+        ++statistics.seed_inputs;
+        if ((flags & (execution_record::BRANCH_DISCOVERED | execution_record::BRANCH_COVERED)) != 0)
+            ++statistics.seed_inputs_contributing;
+    }
+
     ++num_driver_executions;
 
+    if (termination_props.max_server_megabytes > 0U && num_driver_executions % MEMORY_CHECK_PERIOD == 0U)
+        enforce_memory_budget();
+
     return { flags, get_analysis_name_from_state(state) };
 }
 
 
-bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termination_reason)
+bool  fuzzer::generate_next_input(input_bits&  stdin_bits, TERMINATION_REASON&  termination_reason)
 {
     TMPROF_BLOCK();
 
@@ -1232,7 +1354,7 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
     {
         if (get_performed_driver_executions() > 0U)
         {
-            if (uncovered_branchings.empty())
+            if (coverage.num_uncovered() == 0UL)
             {
                 terminate();
                 termination_reason = TERMINATION_REASON::ALL_REACHABLE_BRANCHINGS_COVERED;
@@ -1255,10 +1377,19 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
             return false;
         }
 
+        // Results of the input flow analysis are applied in the first round after its start
+        // in the deterministic mode, rather than whenever the worker happens to finish.
+        if (termination_props.deterministic)
+            input_flow_thread.wait_until_finished();
+
         if (input_flow_thread.is_finished())
         {
             input_flow_thread.apply_results(entry_branching);
 
+            // The nodes already in the queue of targets must not stay ranked by their old sensitive bits.
+            for (branching_node* const  node : input_flow_thread.get_changed_nodes())
+                primary_coverage_targets.update(node);
+
             for (branching_node*  node = input_flow_thread.get_node(); node != nullptr; node = node->get_predecessor())
                 if (!node->is_closed())
                 {
@@ -1277,7 +1408,7 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
                             recorder().on_bitshare_stop(progress_recorder::STOP::INTERRUPTED);
                         break;
                     case LOCAL_SEARCH:
-                        if (local_search.is_busy())
+                        if (active_local_search_slot().local_search.is_busy())
                             recorder().on_local_search_stop(progress_recorder::STOP::INTERRUPTED);
                         break;
                     case BITFLIP:
@@ -1297,8 +1428,8 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
                             recorder().on_bitshare_start(bitshare.get_node(), progress_recorder::START::RESUMED);
                         break;
                     case LOCAL_SEARCH:
-                        if (local_search.is_busy())
-                            recorder().on_local_search_start(local_search.get_node(), progress_recorder::START::RESUMED);
+                        if (active_local_search_slot().local_search.is_busy())
+                            recorder().on_local_search_start(active_local_search_slot().local_search.get_node(), progress_recorder::START::RESUMED);
                         break;
                     case BITFLIP:
                         if (bitflip.is_busy())
@@ -1316,7 +1447,8 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
             else
                 primary_coverage_targets.do_cleanup();
         }
-        if (input_flow_thread.is_ready() && primary_coverage_targets.num_sensitive_targets() < 5000ULL)
+        // No sensitivity analysis is started before all seed inputs are executed (in the state STARTUP).
+        if (input_flow_thread.is_ready() && seed_inputs.empty() && primary_coverage_targets.num_sensitive_targets() < 5000ULL)
         {
             branching_node*  winner{ primary_coverage_targets.get_best_others(max_input_width) };
             if (winner == nullptr && entry_branching != nullptr && !entry_branching->is_closed())
@@ -1345,8 +1477,7 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
                                 bitshare.stop();
                             break;
                         case LOCAL_SEARCH:
-                            if (!local_search.get_node()->has_unexplored_direction())
-                                local_search.stop();
+                            stop_local_searches_without_unexplored_direction();
                             break;
                         default:
                             break;
@@ -1355,7 +1486,7 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
                 coverage_control.reset_period();
             }
         }
-        else if (state == BITFLIP)
+        else if (state == BITFLIP || state == STARTUP)
             coverage_control.reset_period();
         else
         {
@@ -1377,6 +1508,12 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
             case STARTUP:
                 if (get_performed_driver_executions() == 0U)
                     return true;
+                if (!seed_inputs.empty())
+                {
+                    stdin_bits.swap(seed_inputs.front());
+                    seed_inputs.pop_front();
+                    return true;
+                }
                 break;
 
             case BITSHARE:
@@ -1385,7 +1522,7 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
                 break;
 
             case LOCAL_SEARCH:
-                if (local_search.generate_next_input(stdin_bits))
+                if (generate_next_local_search_input(stdin_bits))
                     return true;
                 break;
 
@@ -1406,8 +1543,7 @@ bool  fuzzer::generate_next_input(vecb&  stdin_bits, TERMINATION_REASON&  termin
                                     bitshare.stop();
                                 break;
                             case LOCAL_SEARCH:
-                                if (!local_search.get_node()->has_unexplored_direction())
-                                    local_search.stop();
+                                stop_local_searches_without_unexplored_direction();
                                 break;
                             default:
                                 break;
@@ -1442,32 +1578,36 @@ execution_record::execution_flags  fuzzer::process_execution_results()
     if (state == FINISHED)
         return 0;
 
-    stdin_bits_and_types_pointer const  bits_and_types{ std::make_shared<stdin_bits_and_types>(
-            iomodels::iomanager::instance().get_stdin()->get_bytes(),
-            iomodels::iomanager::instance().get_stdin()->get_types()
-            ) };
-    execution_trace_pointer const  trace = std::make_shared<execution_trace>(iomodels::iomanager::instance().get_trace());
-    br_instr_execution_trace_pointer const  br_instr_trace = std::make_shared<br_instr_execution_trace>(iomodels::iomanager::instance().get_br_instr_trace());
+    stdin_bits_and_types_pointer const  bits_and_types{ stdin_pool.acquire([this](stdin_bits_and_types&  result) {
+            result.assign(context.io.get_stdin()->get_bytes(), context.io.get_stdin()->get_types());
+            }) };
+
+    stored_execution_trace const  trace = store_execution_trace();
+    stored_br_instr_execution_trace const  br_instr_trace = br_instr_execution_traces.insert(context.io.get_br_instr_trace());
+    cmp_operands_trace_pointer const  cmp_operands{ acquire_cmp_operands_trace() };
 
     execution_record::execution_flags  exe_flags { 0U };
 
-    if (!trace->empty())
+    if (!trace.empty())
     {
         leaf_branching_construction_props  construction_props;
 
         if (entry_branching == nullptr)
         {
             entry_branching = new branching_node(
-                    trace->front().id,
+                    trace.front().id,
                     0,
-                    trace->front().num_input_bytes,
-                    trace->front().xor_like_branching_function,
-                    trace->front().predicate,
+                    trace.front().num_input_bytes,
+                    trace.front().xor_like_branching_function,
+                    trace.front().predicate,
+                    nullptr,
                     nullptr,
                     bits_and_types,
                     trace,
                     br_instr_trace,
-                    num_driver_executions
+                    cmp_operands,
+                    num_driver_executions,
+                    context.fresh_guid()
                     );
             construction_props.diverging_node = entry_branching;
 
@@ -1476,89 +1616,92 @@ execution_record::execution_flags  fuzzer::process_execution_results()
 
         construction_props.leaf = entry_branching;
 
+        // The trace mostly follows a path already in the tree up to the node the input was derived
+        // from. Along that path, the tree itself proves the prefix of the trace: each direction taken
+        // has its successor, so it was visited by an earlier trace and the coverage cannot change.
+        // So, the prefix only checks for dead nodes and better values, and it skips the probes of
+        // the coverage and the updates of 'last_occurrences'. The occurrences along the prefix are
+        // needed only when a new node is created and its previous occurrence is not found among the
+        // records after the prefix; then they are collected from the predecessors (once per trace).
+        bool  in_explored_prefix{ true };
+        branching_node*  explored_prefix_end{ nullptr };
+
         trace_index_type  trace_index = 0;
         for (; true; ++trace_index)
         {
-            branching_coverage_info const&  info = trace->at(trace_index);
+            branching_coverage_info const&  info = trace.at(trace_index);
 
             INVARIANT(construction_props.leaf->get_location_id() == info.id);
 
-            if (covered_branchings.count(info.id) == 0)
+            if (in_explored_prefix)
             {
-                auto const  it_along = uncovered_branchings.find({ info.id, info.direction });
-                if (it_along == uncovered_branchings.end())
+                if (trace_index + 1 < trace.size() && construction_props.leaf->successor(info.direction).pointer != nullptr)
                 {
-                    auto const  it_escape = uncovered_branchings.find({ info.id, !info.direction });
-                    if (it_escape == uncovered_branchings.end())
-                    {
-                        uncovered_branchings.insert({ info.id, !info.direction });
-                        construction_props.any_location_discovered = true;
-
-                        coverage_control.increment_num_covered_branchings();
-                    }
-
-                    construction_props.uncovered_locations[info.id].insert(construction_props.leaf);
+                    map_explored_prefix_record(construction_props.leaf, info, trace, bits_and_types, br_instr_trace, cmp_operands);
+                    construction_props.leaf = construction_props.leaf->successor(info.direction).pointer;
+                    ++statistics.trace_records_in_explored_prefix;
+                    continue;
                 }
-                else
-                {
-                    uncovered_branchings.erase(it_along);
-                    covered_branchings.insert(info.id);
+                in_explored_prefix = false;
+                explored_prefix_end = construction_props.leaf;
+            }
 
+            switch (coverage.visit(info.id, info.direction))
+            {
+                case coverage_state::ALREADY_COVERED:
+                    break;
+                case coverage_state::DISCOVERED:
+                    construction_props.any_location_discovered = true;
+                    coverage_control.increment_num_covered_branchings();
+                    [[fallthrough]];
+                case coverage_state::STILL_UNCOVERED:
+                    construction_props.uncovered_locations[info.id].insert(construction_props.leaf);
+                    break;
+                case coverage_state::COVERED:
                     construction_props.uncovered_locations.erase(info.id);
                     construction_props.covered_locations.insert(info.id);
-
+                    change_events.covered_locations.push_back(info.id);
                     coverage_control.increment_num_covered_branchings();
-                }
-            }
-
-            // Here we try to remove bad float (INF, NaN) from 'info.value'.
-            // It would be better, if fuzzer and analyses could deal with bad floats, but that is complicated. 
-            if (!std::isfinite(info.value) || std::isnan(info.value))
-            {
-                branching_function_value_type&  value_ref{ const_cast<branching_function_value_type&>(info.value) };
-                switch (info.predicate)
-                {
-                    case BRANCHING_PREDICATE::BP_EQUAL:
-                        value_ref = info.direction ? 0.0 : std::numeric_limits<branching_function_value_type>::max();
-                        break;
-                    case BRANCHING_PREDICATE::BP_UNEQUAL:
-                        value_ref = info.direction ? std::numeric_limits<branching_function_value_type>::max() : 0.0;
-                        break;
-                    case BRANCHING_PREDICATE::BP_LESS_EQUAL:
-                    case BRANCHING_PREDICATE::BP_LESS:
-                        value_ref = (info.direction ? -1.0 : 1.0) * std::numeric_limits<branching_function_value_type>::max();
-                        break;
-                        break;
-                    case BRANCHING_PREDICATE::BP_GREATER:
-                    case BRANCHING_PREDICATE::BP_GREATER_EQUAL:
-                        value_ref = (info.direction ? 1.0 : -1.0) * std::numeric_limits<branching_function_value_type>::max();
-                        break;
-                    default: UNREACHABLE(); break;
-                }
+                    break;
+                default: { UNREACHABLE(); break; }
             }
 
             if (!construction_props.leaf->is_direction_unexplored(false) && !construction_props.leaf->is_direction_unexplored(true))
             {
                 construction_props.leaf->release_best_data(false);
-                dead_nodes_buffer.insert(construction_props.leaf);
+                change_events.dead_nodes.insert(construction_props.leaf);
             }
             else if (std::fabs(info.value) < std::fabs(construction_props.leaf->get_best_value()))
-                construction_props.leaf->update_best_data(bits_and_types, trace, br_instr_trace, num_driver_executions);
+                construction_props.leaf->update_best_data(bits_and_types, trace, br_instr_trace, cmp_operands, num_driver_executions);
 
             construction_props.leaf->set_max_successors_trace_index(std::max(
                     construction_props.leaf->get_max_successors_trace_index(),
-                    (trace_index_type)(trace->size() - 1)
+                    (trace_index_type)(trace.size() - 1)
                     ));
 
-            if (trace_index + 1 == trace->size())
+            if (trace_index + 1 == trace.size())
                 break;
 
+            construction_props.last_occurrences.insert_or_assign(info.id, construction_props.leaf);
+
             if (construction_props.leaf->successor(info.direction).pointer == nullptr)
             {
                 for (branching_node*  node = construction_props.leaf; node != nullptr && node->is_closed(); node = node->get_predecessor())
                     node->set_closed(false);
 
-                branching_coverage_info const&  succ_info = trace->at(trace_index + 1);
+                if (leaf_branchings.contains(construction_props.leaf))
+                    change_events.leaves_with_successors.push_back(construction_props.leaf);
+
+                branching_coverage_info const&  succ_info = trace.at(trace_index + 1);
+                auto  it_previous_occurrence = construction_props.last_occurrences.find(succ_info.id);
+                if (it_previous_occurrence == construction_props.last_occurrences.end() && explored_prefix_end != nullptr)
+                {
+                    // Occurrences after the prefix are nearer, so they are kept.
+                    for (branching_node*  node = explored_prefix_end->get_predecessor(); node != nullptr; node = node->get_predecessor())
+                        construction_props.last_occurrences.try_emplace(node->get_location_id(), node);
+                    explored_prefix_end = nullptr;
+                    it_previous_occurrence = construction_props.last_occurrences.find(succ_info.id);
+                }
                 construction_props.leaf->set_successor(info.direction, {
                     branching_node::successor_pointer::VISITED,
                     new branching_node(
@@ -1568,10 +1711,13 @@ execution_record::execution_flags  fuzzer::process_execution_results()
                         succ_info.xor_like_branching_function,
                         succ_info.predicate,
                         construction_props.leaf,
+                        it_previous_occurrence == construction_props.last_occurrences.end() ? nullptr : it_previous_occurrence->second,
                         bits_and_types,
                         trace,
                         br_instr_trace,
-                        num_driver_executions
+                        cmp_operands,
+                        num_driver_executions,
+                        context.fresh_guid()
                         )
                 });
 
@@ -1584,14 +1730,16 @@ execution_record::execution_flags  fuzzer::process_execution_results()
             construction_props.leaf = construction_props.leaf->successor(info.direction).pointer;
         }
 
-        construction_props.leaf->set_successor(trace->back().direction, {
+        statistics.trace_records_mapped += trace.size();
+
+        construction_props.leaf->set_successor(trace.back().direction, {
             std::max(
-                iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::normal ?
+                context.io.get_termination() == instrumentation::target_termination::normal ?
                     branching_node::successor_pointer::END_NORMAL :
                     branching_node::successor_pointer::END_EXCEPTIONAL,
-                construction_props.leaf->successor(trace->back().direction).label
+                construction_props.leaf->successor(trace.back().direction).label
                 ),
-            construction_props.leaf->successor(trace->back().direction).pointer
+            construction_props.leaf->successor(trace.back().direction).pointer
         });
 
         if (construction_props.diverging_node != nullptr)
@@ -1618,7 +1766,7 @@ execution_record::execution_flags  fuzzer::process_execution_results()
 
         recorder().on_trace_mapped_to_tree(construction_props.leaf);
 
-        if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::crash)
+        if (context.io.get_termination() == instrumentation::target_termination::crash)
         {
             ++statistics.traces_to_crash;
 
@@ -1627,13 +1775,13 @@ execution_record::execution_flags  fuzzer::process_execution_results()
                 exe_flags |= execution_record::EXECUTION_CRASHES;
         }
 
-        if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::boundary_condition_violation)
+        if (context.io.get_termination() == instrumentation::target_termination::boundary_condition_violation)
         {
             ++statistics.traces_to_boundary_violation;
             exe_flags |= execution_record::BOUNDARY_CONDITION_VIOLATION;
         }
 
-        if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::medium_overflow)
+        if (context.io.get_termination() == instrumentation::target_termination::medium_overflow)
         {
             ++statistics.traces_to_medium_overflow;
             exe_flags |= execution_record::MEDIUM_OVERFLOW;
@@ -1649,37 +1797,37 @@ execution_record::execution_flags  fuzzer::process_execution_results()
     {
         recorder().on_trace_mapped_to_tree(nullptr);
 
-        if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::crash)
+        if (context.io.get_termination() == instrumentation::target_termination::crash)
         {
             ++statistics.traces_to_crash;
             exe_flags |= execution_record::EXECUTION_CRASHES;
         }
 
-        if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::boundary_condition_violation)
+        if (context.io.get_termination() == instrumentation::target_termination::boundary_condition_violation)
         {
             ++statistics.traces_to_boundary_violation;
             exe_flags |= execution_record::BOUNDARY_CONDITION_VIOLATION;
         }
 
-        if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::medium_overflow)
+        if (context.io.get_termination() == instrumentation::target_termination::medium_overflow)
         {
             ++statistics.traces_to_medium_overflow;
             exe_flags |= execution_record::MEDIUM_OVERFLOW;
         }
 
-        if (state == STARTUP)
+        if (state == STARTUP && num_driver_executions == 0U)
             exe_flags |= execution_record::EMPTY_STARTUP_TRACE;
     }
 
     switch (state)
     {
         case STARTUP:
-            INVARIANT(bitshare.is_ready() && local_search.is_ready());
+            INVARIANT(bitshare.is_ready() && !is_any_local_search_busy());
             recorder().on_execution_results_available();
             break;
 
         case BITSHARE:
-            INVARIANT(bitshare.is_busy() && local_search.is_ready());
+            INVARIANT(bitshare.is_busy() && !is_any_local_search_busy());
             recorder().on_execution_results_available();
             bitshare.process_execution_results(trace);
             if (!bitshare.get_node()->has_unexplored_direction())
@@ -1687,13 +1835,28 @@ execution_record::execution_flags  fuzzer::process_execution_results()
             break;
 
         case LOCAL_SEARCH:
-            INVARIANT(bitshare.is_ready() && local_search.is_busy());
-            recorder().on_execution_results_available();
-            local_search.process_execution_results(trace, bits_and_types);
-            if (!local_search.get_node()->has_unexplored_direction())
             {
-                local_search.stop();
-                bitshare.bits_available_for_branching(local_search.get_node(), trace, bits_and_types);
+                // The results belong to the search which generated the input.
+                input_to_state_analysis&  input_to_state{ active_local_search_slot().input_to_state };
+                local_search_analysis&  local_search{ active_local_search_slot().local_search };
+                INVARIANT(bitshare.is_ready() && local_search.is_busy());
+                recorder().on_execution_results_available();
+                if (input_to_state.is_busy())
+                {
+                    input_to_state.process_execution_results();
+                    if (!local_search.get_node()->has_unexplored_direction())
+                    {
+                        local_search.stop();
+                        bitshare.bits_available_for_branching(local_search.get_node(), trace, bits_and_types);
+                    }
+                    break;
+                }
+                local_search.process_execution_results(trace, bits_and_types);
+                if (!local_search.get_node()->has_unexplored_direction())
+                {
+                    local_search.stop();
+                    bitshare.bits_available_for_branching(local_search.get_node(), trace, bits_and_types);
+                }
             }
             break;
 
@@ -1711,13 +1874,216 @@ execution_record::execution_flags  fuzzer::process_execution_results()
 }
 
 
+stored_execution_trace  fuzzer::store_execution_trace()
+{
+    // Here we try to remove bad float (INF, NaN) from values in the trace. It must be done before
+    // the trace is inserted to the store, because stored records are immutable and shared.
+    // It would be better, if fuzzer and analyses could deal with bad floats, but that is complicated. 
+    execution_trace&  raw_trace{ raw_trace_buffer };
+    raw_trace.assign(context.io.get_trace().begin(), context.io.get_trace().end());
+    for (branching_coverage_info&  info : raw_trace)
+        if (!std::isfinite(info.value) || std::isnan(info.value))
+        {
+            branching_function_value_type&  value_ref{ info.value };
+            switch (info.predicate)
+            {
+                case BRANCHING_PREDICATE::BP_EQUAL:
+                    value_ref = info.direction ? 0.0 : std::numeric_limits<branching_function_value_type>::max();
+                    break;
+                case BRANCHING_PREDICATE::BP_UNEQUAL:
+                    value_ref = info.direction ? std::numeric_limits<branching_function_value_type>::max() : 0.0;
+                    break;
+                case BRANCHING_PREDICATE::BP_LESS_EQUAL:
+                case BRANCHING_PREDICATE::BP_LESS:
+                    value_ref = (info.direction ? -1.0 : 1.0) * std::numeric_limits<branching_function_value_type>::max();
+                    break;
+                    break;
+                case BRANCHING_PREDICATE::BP_GREATER:
+                case BRANCHING_PREDICATE::BP_GREATER_EQUAL:
+                    value_ref = (info.direction ? 1.0 : -1.0) * std::numeric_limits<branching_function_value_type>::max();
+                    break;
+                default: UNREACHABLE(); break;
+            }
+        }
+
+    return execution_traces.insert(raw_trace);
+}
+
+
+void  fuzzer::map_explored_prefix_record(
+        branching_node* const  node,
+        branching_coverage_info const&  info,
+        stored_execution_trace const&  trace,
+        stdin_bits_and_types_pointer const&  bits_and_types,
+        stored_br_instr_execution_trace const&  br_instr_trace,
+        cmp_operands_trace_pointer const&  cmp_operands
+        )
+{
+    if (!node->is_direction_unexplored(false) && !node->is_direction_unexplored(true))
+    {
+        // A node without the best data was already reported dead by an earlier trace.
+        if (node->get_best_stdin() != nullptr)
+        {
+            node->release_best_data(false);
+            change_events.dead_nodes.insert(node);
+        }
+    }
+    else if (std::fabs(info.value) < std::fabs(node->get_best_value()))
+        node->update_best_data(bits_and_types, trace, br_instr_trace, cmp_operands, num_driver_executions);
+
+    node->set_max_successors_trace_index(std::max(node->get_max_successors_trace_index(), (trace_index_type)(trace.size() - 1)));
+}
+
+
+cmp_operands_trace_pointer  fuzzer::acquire_cmp_operands_trace()
+{
+    cmp_operands_trace const&  operands{ context.io.get_cmp_operands_trace() };
+    if (operands.empty())
+        return nullptr;
+    return cmp_operands_pool.acquire([&operands](cmp_operands_trace&  result) { result.assign(operands.begin(), operands.end()); });
+}
+
+
+std::size_t  fuzzer::measure_memory_usage() const
+{
+    // Only the nodes of this campaign; the pools are shared by all campaigns of the process.
+    statistics.memory_nodes_bytes = (statistics.nodes_created - statistics.nodes_destroyed) * branching_node::get_memory_bytes_per_node();
+    // Shared chunks and buffers are counted once, by their stores and pools.
+    statistics.memory_traces_bytes = execution_traces.get_statistics().live_bytes
+                                   + br_instr_execution_traces.get_statistics().live_bytes
+                                   + cmp_operands_pool.get_statistics().live_bytes;
+    statistics.memory_inputs_bytes = stdin_pool.get_statistics().live_bytes;
+    statistics.memory_bitshare_bytes = bitshare.get_memory_bytes();
+    statistics.memory_iid_histograms_bytes = *iid_histograms_bytes;
+    statistics.memory_execution_cache_bytes = execution_cache_ptr == nullptr ? 0UL : execution_cache_ptr->get_memory_bytes();
+
+    return statistics.memory_nodes_bytes
+         + statistics.memory_traces_bytes
+         + statistics.memory_inputs_bytes
+         + statistics.memory_bitshare_bytes
+         + statistics.memory_iid_histograms_bytes
+         + statistics.memory_execution_cache_bytes;
+}
+
+
+void  fuzzer::collect_eviction_candidates(std::vector<branching_node*>&  candidates) const
+{
+    TMPROF_BLOCK();
+
+    std::vector<branching_node*>  work_list;
+    if (entry_branching != nullptr)
+        work_list.push_back(entry_branching);
+    while (!work_list.empty())
+    {
+        branching_node* const  node = work_list.back();
+        work_list.pop_back();
+        for (bool  direction : { false, true })
+            if (node->successor(direction).pointer != nullptr)
+                work_list.push_back(node->successor(direction).pointer);
+
+        // The nodes processed by analyses right now are never evicted.
+        if (!node->get_best_trace().empty() && !is_processed_by_local_search(node))
+            candidates.push_back(node);
+    }
+}
+
+
+void  fuzzer::enforce_memory_budget()
+{
+    TMPROF_BLOCK();
+
+    ++statistics.memory_checks;
+
+    std::size_t const  budget_bytes{ (std::size_t)termination_props.max_server_megabytes * 1024UL * 1024UL };
+
+    if (measure_memory_usage() <= budget_bytes)
+        return;
+
+    // Both caches are rebuilt on demand, so they are released first.
+    loop_detection.clear();
+    if (execution_cache_ptr != nullptr)
+        execution_cache_ptr->clear();
+
+    if (measure_memory_usage() > budget_bytes)
+    {
+        // Only here we need to walk the tree.
+        std::vector<branching_node*>  candidates;
+        collect_eviction_candidates(candidates);
+
+        // Evicted traces are rebuilt on demand, so coverage is not affected. Traces of closed
+        // nodes are evicted first, because analyses are not likely to ask for them; then the
+        // older the best input of a node is, the sooner its traces are evicted.
+        std::sort(candidates.begin(), candidates.end(), [](branching_node const* const  l, branching_node const* const  r) {
+            if (l->is_closed() != r->is_closed())
+                return l->is_closed();
+            return l->get_best_value_execution() < r->get_best_value_execution();
+        });
+
+        // Chunks of traces are shared, so the memory released per evicted node is not known in advance.
+        std::size_t constexpr  batch_size{ 64UL };
+        for (std::size_t  i = 0UL; i < candidates.size() && measure_memory_usage() > budget_bytes; )
+            for (std::size_t const  end = std::min(i + batch_size, candidates.size()); i != end; ++i)
+            {
+                candidates.at(i)->evict_best_trace();
+                ++statistics.evicted_traces;
+            }
+    }
+
+    if (measure_memory_usage() > budget_bytes && termination_props.lossy_eviction)
+        statistics.evicted_bitshare_samples += bitshare.evict_old_samples();
+
+    if (measure_memory_usage() > budget_bytes)
+        ++statistics.memory_budget_overruns;
+}
+
+
+bool  fuzzer::rebuild_best_trace(branching_node* const  node)
+{
+    TMPROF_BLOCK();
+
+    ASSUMPTION(node != nullptr && node->is_best_trace_evicted());
+
+    if (rebuild_executor == nullptr)
+    {
+        ++statistics.failed_rebuilds;
+        return false;
+    }
+
+    context.io.get_stdin()->clear();
+    context.io.get_stdout()->clear();
+    context.io.get_stdin()->set_bytes(node->get_best_stdin()->bits.bytes());
+
+    rebuild_executor();
+
+    stored_execution_trace const  trace{ store_execution_trace() };
+    stored_br_instr_execution_trace const  br_instr_trace{ br_instr_execution_traces.insert(context.io.get_br_instr_trace()) };
+    cmp_operands_trace_pointer const  cmp_operands{ acquire_cmp_operands_trace() };
+
+    context.io.get_stdin()->clear();
+    context.io.get_stdout()->clear();
+
+    // A non-deterministic target may not reach the node again.
+    if (trace.size() <= node->get_trace_index() || trace.at(node->get_trace_index()).id != node->get_location_id())
+    {
+        ++statistics.failed_rebuilds;
+        return false;
+    }
+
+    node->restore_best_trace(trace, br_instr_trace, cmp_operands);
+
+    ++statistics.rebuilt_traces;
+
+    return true;
+}
+
+
 void  fuzzer::do_cleanup()
 {
     TMPROF_BLOCK();
 
     INVARIANT(
         bitshare.is_ready() &&
-        local_search.is_ready() &&
+        !is_any_local_search_busy() &&
         (state != FINISHED || !primary_coverage_targets.empty())
         );
 
@@ -1727,35 +2093,28 @@ void  fuzzer::do_cleanup()
             update_close_flags_from(bitshare.get_node());
             break;
         case LOCAL_SEARCH:
-            update_close_flags_from(local_search.get_node());
-            if (!covered_branchings.contains(local_search.get_node()->get_location_id()))
-                coverage_failures_with_hope.insert(local_search.get_node());
+            for (local_search_slot&  slot : local_search_slots)
+                on_local_search_finished(slot);
             break;
         default:
             break;
     }
 
-    std::vector<branching_node*> leaves_to_remove;
-    for (branching_node*  leaf : leaf_branchings)
-        if (leaf->successor(false).pointer != nullptr || leaf->successor(true).pointer != nullptr)
-            leaves_to_remove.push_back(leaf);
-    while (!leaves_to_remove.empty())
-    {
-        remove_leaf_branching_node(leaves_to_remove.back());
-        leaves_to_remove.pop_back();
-    }
+    for (branching_node*  leaf : change_events.leaves_with_successors)
+        if (leaf_branchings.contains(leaf))
+        {
+            INVARIANT(leaf->successor(false).pointer != nullptr || leaf->successor(true).pointer != nullptr);
+            remove_leaf_branching_node(leaf);
+        }
 
     primary_coverage_targets.do_cleanup();
 
     do_cleanup_iid_pivots();
 
-    for (auto  it = coverage_failures_with_hope.begin(); it != coverage_failures_with_hope.end(); )
-        if (covered_branchings.contains((*it)->get_location_id()))
-            it = coverage_failures_with_hope.erase(it);
-        else
-            ++it;
+    for (location_id const  id : change_events.covered_locations)
+        coverage_failures_with_hope.erase(id);
 
-    dead_nodes_buffer.clear();
+    change_events.clear();
 }
 
 
@@ -1763,18 +2122,20 @@ void  fuzzer::do_cleanup_iid_pivots()
 {
     TMPROF_BLOCK();
 
-    for (auto  it = iid_pivots.begin(); it != iid_pivots.end(); )
-        if (covered_branchings.contains(it->first))
-            it = iid_pivots.erase(it);
-        else
+    // The events are not consumed here, because they are used by 'do_cleanup' too.
+    // Processing them more times is harmless.
+    for (location_id const  id : change_events.covered_locations)
+        iid_pivots.erase(id);
+    for (branching_node* const  node : change_events.dead_nodes)
+    {
+        auto const  it = iid_pivots.find(node->get_location_id());
+        if (it != iid_pivots.end())
         {
-            for (auto dit = dead_nodes_buffer.begin(); dit != dead_nodes_buffer.end(); ++dit)
-                it->second.pivots.erase(*dit);
+            it->second.pivots.erase(node);
             if (it->second.pivots.empty())
-                it = iid_pivots.erase(it);
-            else
-                ++it;
+                iid_pivots.erase(it);
         }
+    }
 }
 
 
@@ -1786,12 +2147,18 @@ void  fuzzer::collect_iid_pivots_from_sensitivity_results()
 
     std::vector<std::pair<branching_node*, iid_pivot_props*> >  pivots;
     for (branching_node* node : input_flow_thread.get_changed_nodes())
-        if (node->is_iid_branching() && !covered_branchings.contains(node->get_location_id()))
+        if (node->is_iid_branching() && !coverage.is_covered(node->get_location_id()))
         {
-            iid_location_props&  loc_props = iid_pivots[node->get_location_id()];
+            auto const  loc_it_and_state = iid_pivots.try_emplace(node->get_location_id());
+            iid_location_props&  loc_props = loc_it_and_state.first->second;
+            if (loc_it_and_state.second)
+                loc_props.generator_for_pivot_selection.seed(termination_props.random_seed);
             auto const  pivot_it_and_state = loc_props.pivots.insert({ node, {} });
             if (pivot_it_and_state.second)
             {
+                pivot_it_and_state.first->second.generator_for_start_node_selection.seed(termination_props.random_seed);
+                pivot_it_and_state.first->second.generator_for_monte_carlo.seed(termination_props.random_seed);
+
                 if (loc_props.pivot_with_lowest_abs_value == nullptr
                         || std::fabs(node->get_best_value()) < std::fabs(loc_props.pivot_with_lowest_abs_value->get_best_value()))
                     loc_props.pivot_with_lowest_abs_value = node;
@@ -1864,68 +2231,50 @@ void  fuzzer::collect_iid_pivots_from_sensitivity_results()
 
     struct  histograms_builder_and_pure_loop_bodies_cleaner
     {
-        void  run(std::vector<std::pair<branching_node*, iid_pivot_props*> > const&  pivots)
+        void  run(
+                std::vector<std::pair<branching_node*, iid_pivot_props*> > const&  pivots,
+                std::shared_ptr<std::size_t> const&  live_bytes
+                )
         {
-            pivots.begin()->second->histogram_ptr = histogram_of_hit_counts_per_direction::create(nullptr);
-            extend_hit_counts_histogram(pivots.begin()->first, nullptr, pivots.begin()->second->histogram_ptr);
-
-            extend_hit_counts_map(pivots.begin()->second->histogram_ptr);
-            prune_pure_loop_bodies(pivots.begin()->second->pure_loop_bodies);
-
-            for (auto  it_prev = pivots.begin(), it = std::next(it_prev); it != pivots.end(); it_prev = it, ++it)
+            histogram_ptr = histogram_of_hit_counts_per_direction::create(live_bytes);
+            for (auto  it_prev = pivots.end(), it = pivots.begin(); it != pivots.end(); it_prev = it, ++it)
             {
-                it->second->histogram_ptr = histogram_of_hit_counts_per_direction::create(it_prev->second->histogram_ptr);
-                extend_hit_counts_histogram(it->first, it_prev->first, it->second->histogram_ptr);
+                it->second->histogram_ptr = histogram_ptr;
+                it->second->histogram_version = histogram_ptr->push_version();
+                extend_hit_counts_histogram(it->first, it_prev == pivots.end() ? nullptr : it_prev->first);
 
-                extend_hit_counts_map(it->second->histogram_ptr);
-                prune_pure_loop_bodies(it->second->pure_loop_bodies);
+                prune_pure_loop_bodies(it->second->pure_loop_bodies, it->second->histogram_version);
             }
+            histogram_ptr->count_memory_bytes();
         }
 
     private:
 
-        histogram_of_hit_counts_per_direction::hit_counts_map  hit_counts;
+        histogram_of_hit_counts_per_direction::pointer_type  histogram_ptr;
 
-        void  extend_hit_counts_histogram(
-                branching_node const*  pivot,
-                branching_node const*  end,
-                histogram_of_hit_counts_per_direction::pointer_type const  histogram_ptr
-                )
+        void  extend_hit_counts_histogram(branching_node const*  pivot, branching_node const*  end)
         {
             ASSUMPTION(pivot != nullptr);
-            histogram_of_hit_counts_per_direction::hit_counts_map&  target_hit_counts{ histogram_ptr->local_hit_counts_ref() };
             for (branching_node const*  node = pivot; node->get_predecessor() != end; node = node->get_predecessor())
-            {
-                location_id::id_type const  id{ node->get_predecessor()->get_location_id().id };
-                auto const  it_and_state = target_hit_counts.insert({ id, {} });
-                if (it_and_state.second)
-                {
-                    auto const  it_pred = hit_counts.find(id);
-                    if (it_pred != hit_counts.end())
-                        it_and_state.first->second = it_pred->second;
-                }
-                ++it_and_state.first->second[node->get_predecessor()->successor_direction(node)];
-            }
-        }
-
-        void  extend_hit_counts_map(histogram_of_hit_counts_per_direction::pointer_type const  histogram_ptr)
-        {
-            histogram_of_hit_counts_per_direction::hit_counts_map  hit_counts_temp{ histogram_ptr->local_hit_counts() };
-            hit_counts_temp.insert(hit_counts.begin(), hit_counts.end());
-            std::swap(hit_counts, hit_counts_temp);
+                ++histogram_ptr->at_last_version(node->get_predecessor()->get_location_id().id)[
+                        node->get_predecessor()->successor_direction(node)
+                        ];
         }
 
-        void  prune_pure_loop_bodies(std::unordered_set<location_id>&  pure_loop_bodies)
+        void  prune_pure_loop_bodies(
+                std::unordered_set<location_id>&  pure_loop_bodies,
+                histogram_of_hit_counts_per_direction::version_type const  version
+                )
         {
             for (auto  it = pure_loop_bodies.begin(); it != pure_loop_bodies.end(); )
-                if (hit_counts.contains(it->id))
+                if (histogram_ptr->find(it->id, version) != nullptr)
                     ++it;
                 else
                     it = pure_loop_bodies.erase(it);
         }
     };
 
-    histograms_builder_and_pure_loop_bodies_cleaner{}.run(pivots);
+    histograms_builder_and_pure_loop_bodies_cleaner{}.run(pivots, iid_histograms_bytes);
 }
 
 
@@ -1933,7 +2282,7 @@ void  fuzzer::select_next_state()
 {
     TMPROF_BLOCK();
 
-    INVARIANT(bitshare.is_ready() && local_search.is_ready());
+    INVARIANT(bitshare.is_ready() && !is_any_local_search_busy());
 
     branching_node*  winner = nullptr;
     winner = primary_coverage_targets.get_best_sensitive(max_input_width);
@@ -1947,12 +2296,21 @@ void  fuzzer::select_next_state()
         }
     }
 
+    if (winner != nullptr && winner->was_bitshare_performed() && winner->is_best_trace_evicted() && !rebuild_best_trace(winner))
+    {
+        // The local search cannot run without the trace, so we give up on the node.
+        winner->set_local_search_performed(num_driver_executions);
+        primary_coverage_targets.do_cleanup();
+        select_next_state();
+        return;
+    }
+
     if (state == BITFLIP)
         recorder().on_bitflip_stop(progress_recorder::STOP::REGULAR);
 
     if (winner == nullptr)
     {
-        if (sala_program_ptr == nullptr || (!leaf_branchings.empty() && !uncovered_branchings.empty()))
+        if (sala_program_ptr == nullptr || (!leaf_branchings.empty() && coverage.num_uncovered() != 0UL))
         {
             state = BITFLIP;
             if (bitflip.is_ready())
@@ -1979,13 +2337,194 @@ void  fuzzer::select_next_state()
     }
     else
     {
-        INVARIANT(!winner->was_local_search_performed() && !winner->get_sensitive_stdin_bits().empty());
-        local_search.start(winner, num_driver_executions);
+        activate_local_search_slot(0UL);
+        start_local_search(active_local_search_slot(), winner);
         state = LOCAL_SEARCH;
     }
 }
 
 
+void  fuzzer::start_local_search(local_search_slot&  slot, branching_node* const  winner)
+{
+    INVARIANT(!winner->was_local_search_performed() && !winner->get_sensitive_stdin_bits().empty());
+    INVARIANT(slot.local_search.is_ready() && !slot.cleanup_pending);
+
+    slot.input_to_state.start(winner);
+    slot.local_search.start(winner, num_driver_executions);
+    slot.cleanup_pending = true;
+}
+
+
+void  fuzzer::on_local_search_finished(local_search_slot&  slot)
+{
+    INVARIANT(slot.local_search.is_ready());
+
+    if (!slot.cleanup_pending)
+        return;
+    slot.cleanup_pending = false;
+
+    branching_node* const  node{ slot.local_search.get_node() };
+    update_close_flags_from(node);
+    if (!coverage.is_covered(node->get_location_id()))
+        coverage_failures_with_hope[node->get_location_id()].insert(node);
+}
+
+
+bool  fuzzer::refill_local_search_slot(std::size_t const  index)
+{
+    TMPROF_BLOCK();
+
+    local_search_slot&  slot{ local_search_slots.at(index) };
+    INVARIANT(slot.local_search.is_ready() && slot.input_to_state.is_ready());
+
+    on_local_search_finished(slot);
+
+    // A search starts here only beside other running searches. Otherwise, the next node is
+    // selected in 'select_next_state', which may also start bitshare, input flow, or bitflip.
+    if (!is_any_local_search_busy())
+        return false;
+
+    // Rejected candidates are not counted as selected, so they keep their priority (this runs
+    // for each idle slot in each round).
+    while (true)
+    {
+        branching_node* const  winner{ primary_coverage_targets.get_best_sensitive(
+                max_input_width,
+                [this](branching_node* const  node) {
+                    return node->is_pending()
+                        && node->was_bitshare_performed()
+                        && !node->was_local_search_performed()
+                        && !node->get_sensitive_stdin_bits().empty()
+                        && !is_processed_by_local_search(node);
+                }
+                ) };
+        if (winner == nullptr)
+            return false;
+
+        // The rebuild does not disturb the running searches, because the input of this round
+        // is not generated yet.
+        if (winner->is_best_trace_evicted() && !rebuild_best_trace(winner))
+        {
+            // The local search cannot run without the trace, so we give up on the node.
+            winner->set_local_search_performed(num_driver_executions);
+            primary_coverage_targets.erase(winner);
+            continue;
+        }
+
+        activate_local_search_slot(index);
+        start_local_search(slot, winner);
+        // The search marks the node as performed only when it stops. Till then, no other slot may
+        // get it. The node goes back to the queue, when the search is dropped by a checkpoint.
+        primary_coverage_targets.erase(winner);
+
+        return true;
+    }
+}
+
+
+bool  fuzzer::generate_next_local_search_input(input_bits&  stdin_bits)
+{
+    // Busy slots generate inputs in turns, starting with the one after the last active slot.
+    std::size_t const  num_slots{ local_search_slots.size() };
+    for (std::size_t  i = 1UL; i <= num_slots; ++i)
+    {
+        std::size_t const  index{ (active_local_search_slot_index + i) % num_slots };
+        local_search_slot&  slot{ local_search_slots.at(index) };
+        if (!slot.local_search.is_busy())
+        {
+            slot.input_to_state.stop();
+            if (!refill_local_search_slot(index))
+                continue;
+        }
+        activate_local_search_slot(index);
+        if (slot.input_to_state.generate_next_input(stdin_bits))
+            return true;
+        if (slot.local_search.generate_next_input(stdin_bits))
+            return true;
+        slot.input_to_state.stop();
+    }
+    return false;
+}
+
+
+void  fuzzer::activate_local_search_slot(std::size_t const  index)
+{
+    // The progress recorder follows one local search at a time, so we switch it between slots.
+    if (index == active_local_search_slot_index)
+        return;
+    if (active_local_search_slot().local_search.is_busy())
+        recorder().on_local_search_stop(progress_recorder::STOP::INTERRUPTED);
+    active_local_search_slot_index = index;
+    if (active_local_search_slot().local_search.is_busy())
+        recorder().on_local_search_start(active_local_search_slot().local_search.get_node(), progress_recorder::START::RESUMED);
+}
+
+
+void  fuzzer::stop_local_searches_without_unexplored_direction()
+{
+    for (std::size_t  index = 0UL; index != local_search_slots.size(); ++index)
+    {
+        local_search_analysis&  local_search{ local_search_slots.at(index).local_search };
+        if (local_search.is_busy() && !local_search.get_node()->has_unexplored_direction())
+        {
+            activate_local_search_slot(index);
+            local_search.stop();
+        }
+    }
+}
+
+
+bool  fuzzer::is_any_local_search_busy() const
+{
+    for (local_search_slot const&  slot : local_search_slots)
+        if (slot.local_search.is_busy())
+            return true;
+    return false;
+}
+
+
+bool  fuzzer::is_processed_by_local_search(branching_node const* const  node) const
+{
+    for (local_search_slot const&  slot : local_search_slots)
+        if ((slot.local_search.is_busy() && slot.local_search.get_node() == node)
+                || (slot.input_to_state.is_busy() && slot.input_to_state.get_node() == node))
+            return true;
+    return false;
+}
+
+
+local_search_analysis::performance_statistics  fuzzer::get_local_search_statistics() const
+{
+    local_search_analysis::performance_statistics  result{ local_search_slots.front().local_search.get_statistics() };
+    for (std::size_t  index = 1UL; index < local_search_slots.size(); ++index)
+    {
+        local_search_analysis::performance_statistics const&  other{ local_search_slots.at(index).local_search.get_statistics() };
+        result.generated_inputs += other.generated_inputs;
+        result.start_calls += other.start_calls;
+        result.stop_calls_regular += other.stop_calls_regular;
+        result.stop_calls_early += other.stop_calls_early;
+        result.stop_calls_failed += other.stop_calls_failed;
+    }
+    return result;
+}
+
+
+input_to_state_analysis::performance_statistics  fuzzer::get_input_to_state_statistics() const
+{
+    input_to_state_analysis::performance_statistics  result{ local_search_slots.front().input_to_state.get_statistics() };
+    for (std::size_t  index = 1UL; index < local_search_slots.size(); ++index)
+    {
+        input_to_state_analysis::performance_statistics const&  other{ local_search_slots.at(index).input_to_state.get_statistics() };
+        result.generated_inputs += other.generated_inputs;
+        result.start_calls += other.start_calls;
+        result.start_calls_failed += other.start_calls_failed;
+        result.stop_calls_success += other.stop_calls_success;
+        result.stop_calls_depleted += other.stop_calls_depleted;
+    }
+    return result;
+}
+
+
 branching_node*  fuzzer::select_iid_coverage_target() const
 {
     TMPROF_BLOCK();
@@ -2012,17 +2551,14 @@ branching_node*  fuzzer::select_iid_coverage_target() const
             histogram
             );
 
-    histogram_of_hit_counts_per_direction::hit_counts_map  hit_counts;
-    it_pivot->second.histogram_ptr->merge(hit_counts);
-
-    probability_generators_for_locations  generators;
-    auto const  random_uniform_generator = compute_probability_generators_for_locations(
+    monte_carlo_sampling_table  table{ generator_for_generator_selection };
+    compute_monte_carlo_sampling_table(
             histogram,
-            hit_counts,
+            *it_pivot->second.histogram_ptr,
+            it_pivot->second.histogram_version,
             it_pivot->second.pure_loop_bodies,
-            generators,
-            it_pivot->second.generator_for_monte_carlo,
-            generator_for_generator_selection
+            table,
+            it_pivot->second.generator_for_monte_carlo
             );
 
     branching_node*  winner;
@@ -2032,15 +2568,13 @@ branching_node*  fuzzer::select_iid_coverage_target() const
         auto const  node_and_direction = monte_carlo_backward_search(
                 it_pivot->first,
                 entry_branching,
-                histogram,
-                generators,
-                *random_uniform_generator
+                table
                 );
         branching_node* const  successor = node_and_direction.first->successor(node_and_direction.second).pointer;
         if (successor != nullptr)
-            winner = monte_carlo_search(successor, histogram, generators, *random_uniform_generator);
+            winner = monte_carlo_search(successor, table);
         else if (!node_and_direction.first->is_pending())
-            winner = monte_carlo_search(node_and_direction.first, histogram, generators, *random_uniform_generator);
+            winner = monte_carlo_search(node_and_direction.first, table);
         else
             winner = node_and_direction.first;
 
@@ -2055,7 +2589,7 @@ branching_node*  fuzzer::select_iid_coverage_target() const
                 entry_branching
                 );
 
-        winner = monte_carlo_search(start_node, histogram, generators, *random_uniform_generator);
+        winner = monte_carlo_search(start_node, table);
 
         ++statistics.strategy_monte_carlo;
         recorder().on_strategy_turn_monte_carlo();
@@ -2074,6 +2608,7 @@ bool  fuzzer::try_start_input_flow_analysis(branching_node*  winner)
     if (!input_flow_thread.is_ready())
         return false;
 
+    branching_node* const  start_node{ winner };
     while (true)
     {
         branching_node* const  left = winner->successor(false).pointer;
@@ -2091,6 +2626,21 @@ bool  fuzzer::try_start_input_flow_analysis(branching_node*  winner)
         else
             break;
     }
+
+    if (winner->is_best_trace_evicted() && !rebuild_best_trace(winner))
+    {
+        // The nodes on the path cannot be analysed without the trace, so we give up on them.
+        for (branching_node*  node = winner; node != nullptr; node = node->get_predecessor())
+        {
+            if (!node->was_sensitivity_performed())
+                node->set_sensitivity_performed(num_driver_executions);
+            if (node == start_node)
+                break;
+        }
+        primary_coverage_targets.do_cleanup();
+        return false;
+    }
+
     input_flow_thread.start(winner, num_driver_executions, num_remaining_seconds());
 
     // In the block below we only send data to the progress recorder. 
@@ -2102,7 +2652,7 @@ bool  fuzzer::try_start_input_flow_analysis(branching_node*  winner)
                     recorder().on_bitshare_stop(progress_recorder::STOP::INTERRUPTED);
                 break;
             case LOCAL_SEARCH:
-                if (local_search.is_busy())
+                if (active_local_search_slot().local_search.is_busy())
                     recorder().on_local_search_stop(progress_recorder::STOP::INTERRUPTED);
                 break;
             case BITFLIP:
@@ -2122,8 +2672,8 @@ bool  fuzzer::try_start_input_flow_analysis(branching_node*  winner)
                     recorder().on_bitshare_start(bitshare.get_node(), progress_recorder::START::RESUMED);
                 break;
             case LOCAL_SEARCH:
-                if (local_search.is_busy())
-                    recorder().on_local_search_start(local_search.get_node(), progress_recorder::START::RESUMED);
+                if (active_local_search_slot().local_search.is_busy())
+                    recorder().on_local_search_start(active_local_search_slot().local_search.get_node(), progress_recorder::START::RESUMED);
                 break;
             case BITFLIP:
                 if (bitflip.is_busy())
@@ -2142,7 +2692,7 @@ void  fuzzer::remove_leaf_branching_node(branching_node*  node)
     TMPROF_BLOCK();
 
     INVARIANT(bitshare.is_ready() || bitshare.get_node() != node);
-    INVARIANT(local_search.is_ready() || local_search.get_node() != node);
+    INVARIANT(!is_processed_by_local_search(node));
 
     if (leaf_branchings.erase(node) != 0)
         ++statistics.leaf_nodes_destroyed;
@@ -2157,7 +2707,19 @@ void  fuzzer::remove_leaf_branching_node(branching_node*  node)
         branching_node* const  pred = node->get_predecessor();
 
         primary_coverage_targets.erase(node);
-        coverage_failures_with_hope.erase(node);
+        loop_detection.erase(node);
+        change_events.dead_nodes.erase(node);
+        // A leaf which got a successor in this round may have lost it again (the successor was removed).
+        std::erase(change_events.leaves_with_successors, node);
+        {
+            auto const  it = coverage_failures_with_hope.find(node->get_location_id());
+            if (it != coverage_failures_with_hope.end())
+            {
+                it->second.erase(node);
+                if (it->second.empty())
+                    coverage_failures_with_hope.erase(it);
+            }
+        }
 
         auto const  it_iid_loc = iid_pivots.find(node->get_location_id());
         if (it_iid_loc != iid_pivots.end())
@@ -2200,16 +2762,17 @@ void  fuzzer::remove_leaf_branching_node(branching_node*  node)
 
 bool  fuzzer::apply_coverage_failures_with_hope()
 {
-    for (branching_node*  node : coverage_failures_with_hope)
-    {
-        INVARIANT(node->was_local_search_performed());
+    for (auto const&  loc_and_nodes : coverage_failures_with_hope)
+        for (branching_node*  node : loc_and_nodes.second)
+        {
+            INVARIANT(node->was_local_search_performed());
 
-        node->perform_failure_reset();
+            node->perform_failure_reset();
 
-        primary_coverage_targets.process_potential_coverage_target({ node, true });
+            primary_coverage_targets.process_potential_coverage_target({ node, true });
 
-        ++statistics.coverage_failure_resets;
-    }
+            ++statistics.coverage_failure_resets;
+        }
     coverage_failures_with_hope.clear();
     return !primary_coverage_targets.empty();
  }
@@ -0,0 +1,420 @@
+#include <fuzzing/fuzzer.hpp>
+#include <fuzzing/checkpoint.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <utility/timeprof.hpp>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace  fuzzing {
+
+
+void  fuzzer::primary_coverage_target_branchings::save_checkpoint(checkpoint_writer&  writer) const
+{
+    for (auto const*  loop_heads : { &loop_heads_sensitive, &loop_heads_others })
+    {
+        writer.write((natural_64_bit)loop_heads->size());
+        for (branching_node* const  node : *loop_heads)
+            writer.write_node(node);
+    }
+
+    sensitive.save_checkpoint(writer);
+    untouched.save_checkpoint(writer);
+
+    for (auto const*  iid_twins : { &iid_twins_sensitive, &iid_twins_others })
+    {
+        writer.write((natural_64_bit)iid_twins->size());
+        for (auto const&  loc_and_props : *iid_twins)
+        {
+            writer.write(loc_and_props.first);
+            writer.write_node(loc_and_props.second.first);
+            writer.write(loc_and_props.second.second);
+        }
+    }
+
+    writer.write(sensitive_start_index);
+    writer.write(untouched_start_index);
+}
+
+
+void  fuzzer::primary_coverage_target_branchings::load_checkpoint(checkpoint_reader&  reader)
+{
+    ASSUMPTION(empty());
+
+    for (auto*  loop_heads : { &loop_heads_sensitive, &loop_heads_others })
+        for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        {
+            branching_node* const  node{ reader.read_node() };
+            reader.check(node != nullptr);
+            loop_heads->insert(node);
+        }
+
+    sensitive.load_checkpoint(reader);
+    untouched.load_checkpoint(reader);
+
+    for (auto*  iid_twins : { &iid_twins_sensitive, &iid_twins_others })
+        for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        {
+            location_id const  id{ reader.read_location_id() };
+            branching_node* const  node{ reader.read_node() };
+            bool const  flag{ reader.read<bool>() };
+            reader.check(node != nullptr && node->get_location_id() == id);
+            iid_twins->insert({ id, { node, flag } });
+        }
+
+    reader.read(sensitive_start_index);
+    reader.read(untouched_start_index);
+}
+
+
+void  fuzzer::input_flow_analysis_thread::save_checkpoint(checkpoint_writer&  writer) const
+{
+    // The worker cannot start a computation while we hold the lock.
+    std::lock_guard<std::mutex> const lock(mutex);
+    writer.write(state != WORKING);
+    if (state != WORKING)
+        input_flow.save_checkpoint(writer);
+}
+
+
+void  fuzzer::input_flow_analysis_thread::load_checkpoint(checkpoint_reader&  reader)
+{
+    ASSUMPTION(is_ready());
+
+    if (reader.read<bool>())
+        input_flow.load_checkpoint(reader);
+}
+
+
+void  fuzzer::save_checkpoint(checkpoint_writer&  writer) const
+{
+    TMPROF_BLOCK();
+
+    static_assert(std::is_trivially_copyable_v<performance_statistics>);
+
+    writer.write(target_props.num_cond_locations);
+    writer.write(num_driver_executions);
+    writer.write(get_elapsed_seconds());
+    writer.write(max_input_width);
+    writer.write(get_fuzzer_statistics());
+    for (auto const*  generator : {
+            &generator_for_iid_location_selection,
+            &generator_for_iid_approach_selection,
+            &generator_for_generator_selection })
+        writer.write_random_generator(*generator);
+
+    // The tree in the pre-order, the false successor first. Each node is followed
+    // by the mask of its present successors.
+    writer.write(entry_branching != nullptr);
+    {
+        std::vector<branching_node*>  work_list;
+        if (entry_branching != nullptr)
+            work_list.push_back(entry_branching);
+        while (!work_list.empty())
+        {
+            branching_node* const  node = work_list.back();
+            work_list.pop_back();
+
+            writer.register_node(node);
+            node->save_checkpoint(writer);
+
+            natural_8_bit  successors_mask{ 0U };
+            for (bool const  direction : { true, false })
+                if (node->successor(direction).pointer != nullptr)
+                {
+                    successors_mask |= direction ? 2U : 1U;
+                    work_list.push_back(node->successor(direction).pointer);
+                }
+            writer.write(successors_mask);
+        }
+    }
+
+    writer.write((natural_64_bit)leaf_branchings.size());
+    for (branching_node* const  node : leaf_branchings)
+        writer.write_node(node);
+
+    {
+        std::vector<location_id>  covered;
+        coverage.collect_covered(covered);
+        writer.write((natural_64_bit)covered.size());
+        for (location_id const  id : covered)
+            writer.write(id);
+
+        std::vector<branching_location_and_direction>  uncovered;
+        coverage.collect_uncovered(uncovered);
+        writer.write((natural_64_bit)uncovered.size());
+        for (branching_location_and_direction const&  id_and_direction : uncovered)
+        {
+            writer.write(id_and_direction.first);
+            writer.write(id_and_direction.second);
+        }
+    }
+
+    writer.write((natural_64_bit)branchings_to_crashes.size());
+    for (location_id const  id : branchings_to_crashes)
+        writer.write(id);
+
+    primary_coverage_targets.save_checkpoint(writer);
+
+    // Pivots from one sensitivity analysis share their histogram; it is saved only once.
+    {
+        static natural_32_bit constexpr  NO_HISTOGRAM{ std::numeric_limits<natural_32_bit>::max() };
+        std::unordered_map<histogram_of_hit_counts_per_direction const*, natural_32_bit>  histogram_indices;
+
+        writer.write((natural_64_bit)iid_pivots.size());
+        for (auto const&  loc_and_props : iid_pivots)
+        {
+            writer.write(loc_and_props.first);
+            writer.write_node(loc_and_props.second.pivot_with_lowest_abs_value);
+            writer.write_random_generator(loc_and_props.second.generator_for_pivot_selection);
+
+            writer.write((natural_64_bit)loc_and_props.second.pivots.size());
+            for (auto const&  node_and_props : loc_and_props.second.pivots)
+            {
+                iid_pivot_props const&  props{ node_and_props.second };
+
+                writer.write_node(node_and_props.first);
+
+                writer.write((natural_64_bit)props.loop_boundaries.size());
+                for (branching_node* const  node : props.loop_boundaries)
+                    writer.write_node(node);
+
+                writer.write((natural_64_bit)props.pure_loop_bodies.size());
+                for (location_id const  id : props.pure_loop_bodies)
+                    writer.write(id);
+
+                if (props.histogram_ptr == nullptr)
+                    writer.write(NO_HISTOGRAM);
+                else
+                {
+                    auto const  it_and_state = histogram_indices.insert({
+                            props.histogram_ptr.get(),
+                            (natural_32_bit)histogram_indices.size()
+                            });
+                    writer.write(it_and_state.first->second);
+                    if (it_and_state.second)
+                    {
+                        histogram_of_hit_counts_per_direction const&  histogram{ *props.histogram_ptr };
+                        writer.write((natural_64_bit)histogram.num_versions());
+                        for (histogram_of_hit_counts_per_direction::version_type  version = 0U; version != histogram.num_versions(); ++version)
+                        {
+                            writer.write((natural_64_bit)histogram.changed_locations(version).size());
+                            for (location_id::id_type const  id : histogram.changed_locations(version))
+                            {
+                                writer.write(id);
+                                writer.write(*histogram.find(id, version));
+                            }
+                        }
+                    }
+                }
+                writer.write(props.histogram_version);
+
+                writer.write_random_generator(props.generator_for_start_node_selection);
+                writer.write_random_generator(props.generator_for_monte_carlo);
+            }
+        }
+    }
+
+    writer.write((natural_64_bit)change_events.leaves_with_successors.size());
+    for (branching_node* const  node : change_events.leaves_with_successors)
+        writer.write_node(node);
+    writer.write((natural_64_bit)change_events.dead_nodes.size());
+    for (branching_node* const  node : change_events.dead_nodes)
+        writer.write_node(node);
+    writer.write((natural_64_bit)change_events.covered_locations.size());
+    for (location_id const  id : change_events.covered_locations)
+        writer.write(id);
+
+    writer.write((natural_64_bit)coverage_failures_with_hope.size());
+    for (auto const&  loc_and_nodes : coverage_failures_with_hope)
+    {
+        writer.write(loc_and_nodes.first);
+        writer.write((natural_64_bit)loc_and_nodes.second.size());
+        for (branching_node* const  node : loc_and_nodes.second)
+            writer.write_node(node);
+    }
+
+    input_flow_thread.save_checkpoint(writer);
+    bitshare.save_checkpoint(writer);
+    writer.write((natural_64_bit)local_search_slots.size());
+    for (local_search_slot const&  slot : local_search_slots)
+    {
+        slot.local_search.save_checkpoint(writer);
+        slot.input_to_state.save_checkpoint(writer);
+    }
+    // The running searches are not saved, so their nodes (removed from the queue of targets by
+    // 'refill_local_search_slot' and not yet marked as performed) go back to the queue on load.
+    {
+        std::vector<branching_node*>  nodes;
+        for (local_search_slot const&  slot : local_search_slots)
+            if (slot.local_search.is_busy())
+                nodes.push_back(slot.local_search.get_node());
+        writer.write((natural_64_bit)nodes.size());
+        for (branching_node* const  node : nodes)
+            writer.write_node(node);
+    }
+    bitflip.save_checkpoint(writer);
+}
+
+
+void  fuzzer::load_checkpoint(checkpoint_reader&  reader)
+{
+    TMPROF_BLOCK();
+
+    ASSUMPTION(state == STARTUP && num_driver_executions == 0U && entry_branching == nullptr);
+
+    struct  local
+    {
+        static branching_node*  read_node(checkpoint_reader&  reader)
+        {
+            branching_node* const  node{ reader.read_node() };
+            reader.check(node != nullptr);
+            return node;
+        }
+    };
+
+    if (reader.read<natural_32_bit>() != target_props.num_cond_locations)
+        throw std::runtime_error("The checkpoint was saved for a different target.");
+
+    reader.read(num_driver_executions);
+    {
+        float_64_bit const  elapsed_seconds{ reader.read<float_64_bit>() };
+        time_point_current = std::chrono::steady_clock::now();
+        time_point_start = time_point_current - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<float_64_bit>(elapsed_seconds)
+                );
+    }
+    reader.read(max_input_width);
+    reader.read(statistics);
+    for (auto*  generator : {
+            &generator_for_iid_location_selection,
+            &generator_for_iid_approach_selection,
+            &generator_for_generator_selection })
+        reader.read_random_generator(*generator);
+
+    if (reader.read<bool>())
+    {
+        std::vector<std::pair<branching_node*, bool> >  work_list{ { nullptr, false } }; // The predecessor and the direction.
+        while (!work_list.empty())
+        {
+            auto const [predecessor, direction] = work_list.back();
+            work_list.pop_back();
+
+            branching_node* const  node{ new branching_node(reader, predecessor, context.fresh_guid()) };
+            reader.register_node(node);
+            // Not counted in 'statistics.nodes_created'; the loaded statistics already count the node.
+
+            if (predecessor == nullptr)
+                entry_branching = node;
+            else
+            {
+                reader.check(predecessor->successor(direction).label == branching_node::successor_pointer::VISITED);
+                predecessor->successor(direction).pointer = node;
+            }
+
+            natural_8_bit const  successors_mask{ reader.read<natural_8_bit>() };
+            for (bool const  successor_direction : { true, false })
+                if ((successors_mask & (successor_direction ? 2U : 1U)) != 0U)
+                    work_list.push_back({ node, successor_direction });
+        }
+    }
+
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        leaf_branchings.insert(local::read_node(reader));
+
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        coverage.insert_covered(reader.read_location_id());
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+    {
+        location_id const  id{ reader.read_location_id() };
+        coverage.insert_uncovered(id, reader.read<bool>());
+    }
+
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        branchings_to_crashes.insert(reader.read_location_id());
+
+    primary_coverage_targets.load_checkpoint(reader);
+
+    {
+        std::vector<histogram_of_hit_counts_per_direction::pointer_type>  histograms;
+
+        for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        {
+            iid_location_props&  loc_props{ iid_pivots[reader.read_location_id()] };
+            loc_props.pivot_with_lowest_abs_value = reader.read_node();
+            reader.read_random_generator(loc_props.generator_for_pivot_selection);
+
+            for (std::size_t  m = reader.read_size(); m != 0UL; --m)
+            {
+                iid_pivot_props&  props{ loc_props.pivots[local::read_node(reader)] };
+
+                for (std::size_t  k = reader.read_size(); k != 0UL; --k)
+                    props.loop_boundaries.push_back(local::read_node(reader));
+
+                for (std::size_t  k = reader.read_size(); k != 0UL; --k)
+                    props.pure_loop_bodies.insert(reader.read_location_id());
+
+                natural_32_bit const  histogram_index{ reader.read<natural_32_bit>() };
+                if (histogram_index == histograms.size())
+                {
+                    histograms.push_back(histogram_of_hit_counts_per_direction::create(iid_histograms_bytes));
+                    for (std::size_t  num_versions = reader.read_size(); num_versions != 0UL; --num_versions)
+                    {
+                        histograms.back()->push_version();
+                        for (std::size_t  k = reader.read_size(); k != 0UL; --k)
+                        {
+                            location_id::id_type const  id{ reader.read<location_id::id_type>() };
+                            histograms.back()->at_last_version(id) = reader.read<hit_count_per_direction>();
+                        }
+                    }
+                    histograms.back()->count_memory_bytes();
+                }
+                if (histogram_index != std::numeric_limits<natural_32_bit>::max())
+                {
+                    reader.check(histogram_index < histograms.size());
+                    props.histogram_ptr = histograms.at(histogram_index);
+                }
+                reader.read(props.histogram_version);
+                reader.check(props.histogram_ptr == nullptr || props.histogram_version < props.histogram_ptr->num_versions());
+
+                reader.read_random_generator(props.generator_for_start_node_selection);
+                reader.read_random_generator(props.generator_for_monte_carlo);
+            }
+        }
+    }
+
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        change_events.leaves_with_successors.push_back(local::read_node(reader));
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        change_events.dead_nodes.insert(local::read_node(reader));
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        change_events.covered_locations.push_back(reader.read_location_id());
+
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+    {
+        branching_node_set&  nodes{ coverage_failures_with_hope[reader.read_location_id()] };
+        for (std::size_t  m = reader.read_size(); m != 0UL; --m)
+            nodes.insert(local::read_node(reader));
+    }
+
+    input_flow_thread.load_checkpoint(reader);
+    bitshare.load_checkpoint(reader);
+    // The number of slots may differ from the checkpoint. Data of the extra saved slots are dropped.
+    for (std::size_t  i = 0UL, n = reader.read_size(); i != n; ++i)
+    {
+        local_search_slot  dropped_slot{ context.recorder, termination_props.random_seed };
+        local_search_slot&  slot{ i < local_search_slots.size() ? local_search_slots.at(i) : dropped_slot };
+        slot.local_search.load_checkpoint(reader);
+        slot.input_to_state.load_checkpoint(reader);
+    }
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        primary_coverage_targets.process_potential_coverage_target({ local::read_node(reader), true });
+    bitflip.load_checkpoint(reader);
+
+    // The fuzzer stays in the state STARTUP, so the next round selects the next analysis.
+    coverage_control.reset_period();
+}
+
+
+}
@@ -1,5 +1,6 @@
 #include <fuzzing/fuzzing_loop.hpp>
 #include <fuzzing/fuzzer.hpp>
+#include <fuzzing/execution_cache.hpp>
 #include <fuzzing/execution_record.hpp>
 #include <iomodels/iomanager.hpp>
 #include <connection/client_crash_exception.hpp>
@@ -9,43 +10,119 @@
 #include <utility/timeprof.hpp>
 #include <utility/config.hpp>
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
 #include <tuple>
 
 namespace  fuzzing {
 
 
 analysis_outcomes  run(
+        campaign_context&  context,
         connection::benchmark_executor&  benchmark_executor,
         sala::Program const* const sala_program_ptr,
+        target_metadata const&  metadata,
         execution_record_writer&  save_execution_record,
         std::function<void(execution_record const&)> const&  collector_of_boundary_violations,
         fuzzing::termination_info const&  info,
+        std::vector<vecu8> const&  seed_inputs,
+        checkpoint_config const&  checkpoints,
         bool const  render
         )
 {
     TMPROF_BLOCK();
 
+    analysis_outcomes  results;
+    std::unordered_set<natural_64_bit>  hashes_of_crashes;
+    std::unordered_set<location_id::id_type>  exit_locations_of_boundary_violations;
+
+    execution_cache  cache{ context.io, (std::size_t)info.execution_cache_megabytes * 1024UL * 1024UL };
+    fuzzer f{ context, info, sala_program_ptr, metadata };
+    std::function<void()> const  executor{ [&benchmark_executor]() { benchmark_executor(); } };
+
     struct  local
     {
-        static void  fill_record(execution_record&  record)
+        static void  fill_record(iomodels::iomanager const&  io, execution_record&  record)
         {
-            record.stdin_bytes = iomodels::iomanager::instance().get_stdin()->get_bytes();
-            record.stdin_types = iomodels::iomanager::instance().get_stdin()->get_types();
-            for (branching_coverage_info const&  info : iomodels::iomanager::instance().get_trace())
+            record.stdin_bytes = io.get_stdin()->get_bytes();
+            record.stdin_types = io.get_stdin()->get_types();
+            record.path.clear();
+            for (branching_coverage_info const&  info : io.get_trace())
                 record.path.push_back({ info.id, info.direction });
         }
     };
 
-    analysis_outcomes  results;
-    std::unordered_set<natural_64_bit>  hashes_of_crashes;
-    std::unordered_set<location_id::id_type>  exit_locations_of_boundary_violations;
+    // The checkpoint is the state of the fuzzer followed by the state of this loop.
+    auto const  save_checkpoint = [&]() {
+        TMPROF_BLOCK();
 
-    fuzzer f{ info, sala_program_ptr };
+        std::filesystem::path const  temp_pathname{ checkpoints.pathname.string() + ".tmp" };
+        {
+            std::ofstream  ostr(temp_pathname, std::ios_base::binary);
+            checkpoint_writer  writer{ ostr };
+            f.save_checkpoint(writer);
+            writer.write(save_execution_record.get_test_counter());
+            writer.write((natural_64_bit)results.output_statistics.size());
+            for (auto const&  name_and_stats : results.output_statistics)
+            {
+                writer.write(name_and_stats.first);
+                writer.write(name_and_stats.second);
+            }
+            writer.write((natural_64_bit)hashes_of_crashes.size());
+            for (natural_64_bit const  hash : hashes_of_crashes)
+                writer.write(hash);
+            writer.write((natural_64_bit)exit_locations_of_boundary_violations.size());
+            for (location_id::id_type const  id : exit_locations_of_boundary_violations)
+                writer.write(id);
+            ostr.flush();
+            if (!writer.good())
+                throw std::runtime_error("Cannot write the checkpoint '" + temp_pathname.string() + "'.");
+        }
+        // So, a crash during the write does not damage the last checkpoint.
+        std::filesystem::rename(temp_pathname, checkpoints.pathname);
+    };
+
+    auto const  load_checkpoint = [&]() {
+        TMPROF_BLOCK();
+
+        std::ifstream  istr(checkpoints.resume_pathname, std::ios_base::binary);
+        if (!istr.is_open())
+            throw std::runtime_error("Cannot open the checkpoint '" + checkpoints.resume_pathname.string() + "'.");
+        checkpoint_reader  reader{ istr };
+        f.load_checkpoint(reader);
+        save_execution_record.set_test_counter(reader.read<natural_32_bit>());
+        for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        {
+            std::string  name;
+            reader.read(name);
+            reader.read(results.output_statistics[name]);
+        }
+        for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+            hashes_of_crashes.insert(reader.read<natural_64_bit>());
+        for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+            exit_locations_of_boundary_violations.insert(reader.read<location_id::id_type>());
+    };
+
+    f.set_rebuild_executor([&cache, &executor]() { cache.execute(executor); });
+    f.set_execution_cache(&cache);
+    f.set_seed_inputs(seed_inputs);
     f.enable_renderer(render);
     f.render();
 
+    float_64_bit  last_checkpoint_seconds{ 0.0 };
+
+    // Reused by all rounds, so that its vectors keep their capacity (see 'local::fill_record').
+    execution_record  record;
+
     try
     {
+        if (!checkpoints.resume_pathname.empty())
+        {
+            load_checkpoint();
+            last_checkpoint_seconds = f.get_elapsed_seconds();
+        }
+
         while (true)
         {
             if (!f.round_begin(results.termination_reason))
@@ -54,20 +131,24 @@ analysis_outcomes  run(
                 break;
             }
 
+            bool  cached;
             {
                 TMPROF_BLOCK();
-                benchmark_executor();
+                cached = cache.execute(executor);
             }
 
-            execution_record  record;
             std::tie(record.flags, record.analysis_name) = f.round_end();
             f.render();
 
+            ++results.output_statistics[record.analysis_name].num_executions;
+            if (cached)
+                ++results.output_statistics[record.analysis_name].num_cached_executions;
+
             if ((record.flags & (execution_record::BRANCH_DISCOVERED  |
                                  execution_record::BRANCH_COVERED     |
                                  execution_record::EMPTY_STARTUP_TRACE)) != 0)
             {
-                local::fill_record(record);
+                local::fill_record(context.io, record);
                 save_execution_record(record);
                 ++results.output_statistics[record.analysis_name].num_generated_tests;
 
@@ -86,7 +167,7 @@ analysis_outcomes  run(
             }
             else if ((record.flags & execution_record::EXECUTION_CRASHES) != 0)
             {
-                local::fill_record(record);
+                local::fill_record(context.io, record);
                 if (hashes_of_crashes.insert(compute_hash(record.path)).second)
                 {
                     save_execution_record(record);
@@ -96,13 +177,26 @@ analysis_outcomes  run(
             }
             else if ((record.flags & execution_record::BOUNDARY_CONDITION_VIOLATION) != 0)
             {
-                local::fill_record(record);
+                local::fill_record(context.io, record);
                 if (exit_locations_of_boundary_violations.insert(record.path.back().first.id).second)
                 {
                     collector_of_boundary_violations(record);
                     ++results.output_statistics[record.analysis_name].num_boundary_violations;
                 }
             }
+
+            bool const  stop_requested{ checkpoints.stop_request != nullptr && *checkpoints.stop_request != 0 };
+            if (!checkpoints.pathname.empty() && (stop_requested || (checkpoints.period_seconds > 0U &&
+                    f.get_elapsed_seconds() - last_checkpoint_seconds >= (float_64_bit)checkpoints.period_seconds)))
+            {
+                save_checkpoint();
+                last_checkpoint_seconds = f.get_elapsed_seconds();
+            }
+            if (stop_requested)
+            {
+                results.termination_type = analysis_outcomes::TERMINATION_TYPE::INTERRUPTED;
+                break;
+            }
         }
     }
     catch (connection::client_crash_exception const&  e)
@@ -123,15 +217,15 @@ analysis_outcomes  run(
 
     results.num_executions = f.get_performed_driver_executions();
     results.num_elapsed_seconds = f.get_elapsed_seconds();
-    results.covered_branchings.assign(f.get_covered_branchings().begin(), f.get_covered_branchings().end());
-    std::sort(results.covered_branchings.begin(),results.covered_branchings.end());
-    results.uncovered_branchings.assign(f.get_uncovered_branchings().begin(), f.get_uncovered_branchings().end());
-    std::sort(results.uncovered_branchings.begin(),results.uncovered_branchings.end());
+    f.get_coverage().collect_covered(results.covered_branchings);
+    f.get_coverage().collect_uncovered(results.uncovered_branchings);
     results.input_flow_statistics = f.get_input_flow_statistics();
     results.bitshare_statistics = f.get_bitshare_statistics();
     results.local_search_statistics = f.get_local_search_statistics();
+    results.input_to_state_statistics = f.get_input_to_state_statistics();
     results.bitflip_statistics = f.get_bitflip_statistics();
     results.fuzzer_statistics = f.get_fuzzer_statistics();
+    results.execution_cache_statistics = cache.get_statistics();
 
     return  results;
 }
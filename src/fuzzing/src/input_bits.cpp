@@ -0,0 +1,75 @@
+#include <fuzzing/input_bits.hpp>
+#include <utility/assumptions.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace  fuzzing {
+
+
+void  input_bits::assign_bytes(natural_8_bit const* const  begin, natural_8_bit const* const  end)
+{
+    data.assign(begin, end);
+    num_bits = 8UL * data.size();
+}
+
+
+void  input_bits::push_back(bool const  value)
+{
+    if ((num_bits & 7U) == 0U)
+        data.push_back(0U);
+    ++num_bits;
+    set(num_bits - 1UL, value);
+}
+
+
+void  input_bits::resize(std::size_t const  new_num_bits)
+{
+    for (std::size_t  i = new_num_bits; i < num_bits && (i & 7U) != 0U; ++i)
+        set(i, false);
+    data.resize((new_num_bits + 7UL) >> 3U, 0U);
+    num_bits = new_num_bits;
+}
+
+
+void  input_bits::copy_bits(input_bits const&  src, std::size_t  src_begin, std::size_t  dst_begin, std::size_t  count)
+{
+    ASSUMPTION(src_begin + count <= src.size() && dst_begin + count <= size());
+
+    if ((src_begin & 7U) == 0U && (dst_begin & 7U) == 0U)
+    {
+        std::size_t const  num_whole_bytes{ count >> 3U };
+        std::memcpy(&data[dst_begin >> 3U], &src.data[src_begin >> 3U], num_whole_bytes);
+        src_begin += 8UL * num_whole_bytes;
+        dst_begin += 8UL * num_whole_bytes;
+        count -= 8UL * num_whole_bytes;
+    }
+    for ( ; count != 0UL; --count, ++src_begin, ++dst_begin)
+        set(dst_begin, src.at(src_begin));
+}
+
+
+natural_64_bit  input_bits::load_word(std::size_t const  bit_index, std::size_t const  num_value_bytes) const
+{
+    ASSUMPTION((bit_index & 7U) == 0U && num_value_bytes <= sizeof(natural_64_bit));
+    ASSUMPTION((bit_index >> 3U) + num_value_bytes <= data.size());
+
+    natural_64_bit  value{ 0ULL };
+    std::memcpy(&value, &data[bit_index >> 3U], num_value_bytes);
+    return value;
+}
+
+
+void  input_bits::store_word(
+        std::size_t const  bit_index,
+        std::size_t const  num_value_bytes,
+        natural_64_bit const  value,
+        natural_64_bit const  mask
+        )
+{
+    natural_64_bit const  old_value{ load_word(bit_index, num_value_bytes) };
+    natural_64_bit const  new_value{ (old_value & ~mask) | (value & mask) };
+    std::memcpy(&data[bit_index >> 3U], &new_value, num_value_bytes);
+}
+
+
+}
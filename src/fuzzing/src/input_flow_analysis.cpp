@@ -168,7 +168,7 @@ void input_flow_analysis::input_flow::do_ret()
         INVARIANT(data().sensitive_bits.size() < data().trace_size);
 
         trace_index_type const  path_index{ (trace_index_type)data().sensitive_bits.size() };
-        branching_coverage_info const&  branching{ data().trace_ptr->at(path_index) };
+        branching_coverage_info const&  branching{ data().trace.at(path_index) };
 
         if (branching.id.id != parameters().front().read<instrumentation::location_id>().id)
         {
@@ -205,12 +205,11 @@ void input_flow_analysis::input_flow::do_ret()
         }
 
         data().sensitive_bits.push_back({});
-        std::unordered_set<stdin_bit_index>&  sensitive_bits{ data().sensitive_bits.back() };
+        stdin_bit_set&  sensitive_bits{ data().sensitive_bits.back() };
         sala::MemPtr ptr{ parameters().at(2).start() };
         for (std::size_t i = 0ULL; i != sizeof(branching_function_value_type); ++i)
             for (auto const& desc : read(ptr + i)->descriptors())
-                for (std::size_t j = 0ULL; j != 8ULL; ++j)
-                    sensitive_bits.insert(8ULL * desc + j);
+                sensitive_bits.insert((stdin_bit_index)(8ULL * desc), (stdin_bit_index)(8ULL * desc + 8ULL));
 
         if (path_index + 1U == data().trace_size)
         {
@@ -240,8 +239,8 @@ void  input_flow_analysis::run(computation_io_data* const  data_ptr_, std::funct
 {
     ASSUMPTION(
         data_ptr_->input_ptr != nullptr &&
-        data_ptr_->trace_ptr != nullptr &&
-        data_ptr_->trace_size > 0U && data_ptr_->trace_size <= (trace_index_type)data_ptr_->trace_ptr->size()
+        !data_ptr_->trace.empty() &&
+        data_ptr_->trace_size > 0U && data_ptr_->trace_size <= (trace_index_type)data_ptr_->trace.size()
         );
 
     data_ptr = data_ptr_;
@@ -250,11 +249,9 @@ void  input_flow_analysis::run(computation_io_data* const  data_ptr_, std::funct
     if (program_ptr == nullptr)
         return;
 
-    vecu8 stdin_bytes;
-    bits_to_bytes(data().input_ptr->bits, stdin_bytes);
     io_setup().stdin_ptr->clear();
     io_setup().stdout_ptr->clear();
-    io_setup().stdin_ptr->set_bytes(stdin_bytes);
+    io_setup().stdin_ptr->set_bytes(data().input_ptr->bits.bytes());
 
     std::chrono::system_clock::time_point const  start_time = std::chrono::system_clock::now();
 
@@ -271,7 +268,7 @@ void  input_flow_analysis::run(computation_io_data* const  data_ptr_, std::funct
     if (!data().sensitive_bits.empty())
     {
         std::size_t const  last_index{ data().sensitive_bits.size() - 1ULL };
-        branching_coverage_info const&  last_branching{ data().trace_ptr->at(last_index) };
+        branching_coverage_info const&  last_branching{ data().trace.at(last_index) };
         std::pair<natural_32_bit,trace_index_type> const key{ last_index, last_branching.num_input_bytes };
         float_64_bit const  value = std::chrono::duration<float_64_bit>(std::chrono::system_clock::now() - start_time).count();
         //statistics.complexity[key].insert(value);
@@ -280,7 +277,7 @@ void  input_flow_analysis::run(computation_io_data* const  data_ptr_, std::funct
     auto const& make_problem_message = [this](std::string const&  content) {
         std::stringstream  sstr;
         sstr << "{ "
-            << "\"loc_id\": \"" << data().trace_ptr->at(data().trace_size - 1U).id << "\""
+            << "\"loc_id\": \"" << data().trace.at(data().trace_size - 1U).id << "\""
             << ", "
             << "\"details\": " << content
             << " }"
@@ -306,4 +303,47 @@ void  input_flow_analysis::run(computation_io_data* const  data_ptr_, std::funct
 }
 
 
+void  input_flow_analysis::save_checkpoint(checkpoint_writer&  writer) const
+{
+    writer.write((natural_64_bit)statistics.num_successes);
+    writer.write((natural_64_bit)statistics.num_failures);
+    for (auto const*  messages : { &statistics.errors, &statistics.warnings })
+    {
+        writer.write((natural_64_bit)messages->size());
+        for (std::string const&  message : *messages)
+            writer.write(message);
+    }
+    writer.write((natural_64_bit)statistics.complexity.size());
+    for (auto const&  key_and_values : statistics.complexity)
+    {
+        writer.write(key_and_values.first.first);
+        writer.write(key_and_values.first.second);
+        writer.write_vector(std::vector<float_64_bit>{ key_and_values.second.begin(), key_and_values.second.end() });
+    }
+}
+
+
+void  input_flow_analysis::load_checkpoint(checkpoint_reader&  reader)
+{
+    statistics = {};
+    statistics.num_successes = (std::size_t)reader.read<natural_64_bit>();
+    statistics.num_failures = (std::size_t)reader.read<natural_64_bit>();
+    for (auto*  messages : { &statistics.errors, &statistics.warnings })
+        for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+        {
+            std::string  message;
+            reader.read(message);
+            messages->insert(message);
+        }
+    for (std::size_t  n = reader.read_size(); n != 0UL; --n)
+    {
+        trace_index_type const  trace_index{ reader.read<trace_index_type>() };
+        natural_32_bit const  value{ reader.read<natural_32_bit>() };
+        std::vector<float_64_bit>  values;
+        reader.read_vector(values);
+        statistics.complexity[{ trace_index, value }].insert(values.begin(), values.end());
+    }
+}
+
+
 }
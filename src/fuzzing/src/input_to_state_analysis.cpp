@@ -0,0 +1,170 @@
+#include <fuzzing/input_to_state_analysis.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <utility/timeprof.hpp>
+#include <algorithm>
+#include <array>
+
+namespace  fuzzing {
+
+
+input_to_state_analysis::input_to_state_analysis()
+    : state{ READY }
+    , node{ nullptr }
+    , candidates{}
+    , next_candidate_index{ 0UL }
+    , statistics{}
+{}
+
+
+void  input_to_state_analysis::start(branching_node* const  node_ptr)
+{
+    TMPROF_BLOCK();
+
+    ASSUMPTION(is_ready() && node_ptr != nullptr && node_ptr->has_unexplored_direction());
+
+    ++statistics.start_calls;
+
+    cmp_operands_trace_pointer const  operands_trace{ node_ptr->get_best_cmp_operands_trace() };
+    if (operands_trace == nullptr || node_ptr->get_best_stdin() == nullptr)
+    {
+        ++statistics.start_calls_failed;
+        return;
+    }
+
+    auto const  it = std::lower_bound(
+            operands_trace->begin(),
+            operands_trace->end(),
+            node_ptr->get_trace_index(),
+            [](cmp_operands_info const&  info, trace_index_type const  idx) { return info.trace_index < idx; }
+            );
+    if (it == operands_trace->end() || it->trace_index != node_ptr->get_trace_index())
+    {
+        ++statistics.start_calls_failed;
+        return;
+    }
+
+    vecu8 const&  bytes{ node_ptr->get_best_stdin()->bits.bytes() };
+
+    candidates.clear();
+    next_candidate_index = 0UL;
+
+    // The exact value of the other operand is the most promising patch, so all
+    // occurrences get it first; its neighbours then target the predicates <, <=, >, >=.
+    natural_64_bit const  mask{ it->num_bytes >= 8U ? ~0ULL : (1ULL << (8U * it->num_bytes)) - 1ULL };
+    for (natural_64_bit const  delta : { 0ULL, 1ULL, ~0ULL })
+    {
+        insert_candidates(bytes, it->lhs, (it->rhs + delta) & mask, it->num_bytes);
+        insert_candidates(bytes, it->rhs, (it->lhs + delta) & mask, it->num_bytes);
+    }
+
+    if (candidates.empty())
+    {
+        ++statistics.start_calls_failed;
+        return;
+    }
+
+    state = BUSY;
+    node = node_ptr;
+}
+
+
+void  input_to_state_analysis::stop()
+{
+    if (!is_busy())
+        return;
+
+    if (node->has_unexplored_direction())
+        ++statistics.stop_calls_depleted;
+    else
+        ++statistics.stop_calls_success;
+
+    candidates.clear();
+    next_candidate_index = 0UL;
+
+    state = READY;
+}
+
+
+void  input_to_state_analysis::save_checkpoint(checkpoint_writer&  writer) const
+{
+    writer.write(statistics);
+}
+
+
+void  input_to_state_analysis::load_checkpoint(checkpoint_reader&  reader)
+{
+    ASSUMPTION(is_ready());
+
+    reader.read(statistics);
+}
+
+
+bool  input_to_state_analysis::generate_next_input(input_bits&  bits_ref)
+{
+    TMPROF_BLOCK();
+
+    if (!is_busy())
+        return false;
+
+    if (next_candidate_index >= candidates.size())
+    {
+        stop();
+        return false;
+    }
+
+    bits_ref.assign_bytes(candidates.at(next_candidate_index));
+    ++next_candidate_index;
+
+    ++statistics.generated_inputs;
+
+    return true;
+}
+
+
+void  input_to_state_analysis::process_execution_results()
+{
+    ASSUMPTION(is_busy());
+
+    if (!node->has_unexplored_direction())
+        stop();
+}
+
+
+void  input_to_state_analysis::insert_candidates(
+        vecu8 const&  bytes,
+        natural_64_bit const  searched_value,
+        natural_64_bit const  patch_value,
+        natural_8_bit const  num_bytes
+        )
+{
+    INVARIANT(num_bytes > 0U && num_bytes <= 8U);
+
+    std::array<natural_8_bit, 8>  searched_le, patch_le, searched_be, patch_be;
+    for (natural_8_bit  i = 0U; i != num_bytes; ++i)
+    {
+        searched_le.at(i) = (natural_8_bit)(searched_value >> (8U * i));
+        patch_le.at(i) = (natural_8_bit)(patch_value >> (8U * i));
+        searched_be.at(num_bytes - 1U - i) = searched_le.at(i);
+        patch_be.at(num_bytes - 1U - i) = patch_le.at(i);
+    }
+
+    auto const  insert = [this, &bytes, num_bytes](natural_8_bit const* const  searched, natural_8_bit const* const  patch) {
+        for (auto  it = std::search(bytes.begin(), bytes.end(), searched, searched + num_bytes);
+                it != bytes.end() && candidates.size() < max_num_candidates;
+                it = std::search(std::next(it), bytes.end(), searched, searched + num_bytes))
+        {
+            vecu8  candidate{ bytes };
+            std::copy(patch, patch + num_bytes, std::next(candidate.begin(), std::distance(bytes.begin(), it)));
+            if (candidate != bytes && std::find(candidates.begin(), candidates.end(), candidate) == candidates.end())
+                candidates.push_back(std::move(candidate));
+        }
+    };
+
+    insert(searched_le.data(), patch_le.data());
+    if (num_bytes > 1U)
+        insert(searched_be.data(), patch_be.data());
+}
+
+
+}
@@ -1,5 +1,4 @@
 #include <fuzzing/local_search_analysis.hpp>
-#include <fuzzing/progress_recorder.hpp>
 #include <utility/assumptions.hpp>
 #include <utility/invariants.hpp>
 #include <utility/development.hpp>
@@ -10,7 +9,7 @@
 namespace  fuzzing {
 
 
-local_search_analysis::local_search_analysis()
+local_search_analysis::local_search_analysis(progress_recorder&  recorder_, natural_32_bit const  random_seed)
     : state{ READY }
     , node{ nullptr }
     , bits_and_types{ nullptr }
@@ -31,8 +30,9 @@ local_search_analysis::local_search_analysis()
     , descent_props{}
     , mutations_props{}
     , random_props{}
-    , rnd_generator{}
+    , rnd_generator{ random_seed }
     , statistics{}
+    , recorder{ recorder_ }
 {}
 
 
@@ -72,8 +72,8 @@ void  local_search_analysis::start(branching_node* const  node_ptr, natural_32_b
 
     for (trace_index_type  i = 0U; i <= node->get_trace_index(); ++i)
         full_path.push_back({
-                node->get_best_trace()->at(i).id,
-                node->get_best_trace()->at(i).direction,
+                node->get_best_trace().at(i).id,
+                node->get_best_trace().at(i).direction,
                 std::numeric_limits<std::size_t>::max()
                 });
 
@@ -85,7 +85,7 @@ void  local_search_analysis::start(branching_node* const  node_ptr, natural_32_b
     std::map<natural_32_bit, std::pair<type_of_input_bits, std::unordered_set<natural_8_bit> > >  start_bits_to_bit_indices;
     std::vector<std::size_t>  path_node_indices;
     {
-        auto const&  collect_sensitive_bits = [&start_bits_to_bit_indices, this](std::unordered_set<natural_32_bit> const&  sensitive_bits) {
+        auto const&  collect_sensitive_bits = [&start_bits_to_bit_indices, this](stdin_bit_set const&  sensitive_bits) {
             for (stdin_bit_index  idx : sensitive_bits)
             {
                 natural_32_bit const  type_index = bits_and_types->type_index(idx);
@@ -102,27 +102,20 @@ void  local_search_analysis::start(branching_node* const  node_ptr, natural_32_b
                 it_and_state.first->second.second.insert(idx - start_bit_idx);
             }            
         };
-        auto const&  intersect = [](std::unordered_set<natural_32_bit> const&  a, std::unordered_set<natural_32_bit> const&  b) {
-            for (natural_32_bit idx : b)
-                if (a.contains(idx))
-                    return true;
-            return false;
-        };
-
         collect_sensitive_bits(node->get_sensitive_stdin_bits());
         path_node_indices.push_back(full_path_nodes.size() - 1UL);
 
-        std::unordered_set<natural_32_bit>  sensitive_bits{ node->get_sensitive_stdin_bits() };
+        stdin_bit_set  sensitive_bits{ node->get_sensitive_stdin_bits() };
         for (std::size_t  i = 1UL, i_end = full_path_nodes.size(); i != i_end; ++i)
         {
             std::size_t const  node_idx{ i_end - (i + 1UL) };
             branching_node const* const  node_ptr = full_path_nodes.at(node_idx);
-            if (intersect(sensitive_bits, node_ptr->get_sensitive_stdin_bits()))
+            if (sensitive_bits.intersects(node_ptr->get_sensitive_stdin_bits()))
             {
                 collect_sensitive_bits(node_ptr->get_sensitive_stdin_bits());
                 path_node_indices.push_back(node_idx);
 
-                sensitive_bits.insert(node_ptr->get_sensitive_stdin_bits().begin(), node_ptr->get_sensitive_stdin_bits().end());
+                sensitive_bits.unite(node_ptr->get_sensitive_stdin_bits());
             }
         }
 
@@ -134,12 +127,15 @@ void  local_search_analysis::start(branching_node* const  node_ptr, natural_32_b
     {
         start_bits_to_variable_indices.insert({ start_and_type_and_indices.first, (natural_32_bit)from_variables_to_input.size() });
         types_of_variables.push_back(start_and_type_and_indices.second.first);
-        from_variables_to_input.push_back({ start_and_type_and_indices.first, {} });
-        from_variables_to_input.back().value_bit_indices.assign(
+        from_variables_to_input.push_back({ start_and_type_and_indices.first, {}, 0ULL });
+        mapping_to_input_bits&  mapping{ from_variables_to_input.back() };
+        mapping.value_bit_indices.assign(
                 start_and_type_and_indices.second.second.begin(),
                 start_and_type_and_indices.second.second.end()
                 );
-        std::sort(from_variables_to_input.back().value_bit_indices.begin(), from_variables_to_input.back().value_bit_indices.end());
+        std::sort(mapping.value_bit_indices.begin(), mapping.value_bit_indices.end());
+        for (natural_8_bit  idx : mapping.value_bit_indices)
+            set_bit((natural_8_bit*)&mapping.value_bits_mask, idx, true);
     }
 
     INVARIANT(!types_of_variables.empty());
@@ -154,7 +150,7 @@ void  local_search_analysis::start(branching_node* const  node_ptr, natural_32_b
         branching_node const* const  s{ full_path_nodes.at(node_idx + 1UL) }; 
         path.push_back({
                 n,
-                node->get_best_trace()->at(n->get_trace_index()).value,
+                node->get_best_trace().at(n->get_trace_index()).value,
                 n->successor_direction(s),
                 n->successor_direction(s) ? n->get_branching_predicate() : opposite_predicate(n->get_branching_predicate()),
                 n->get_xor_like_branching_function(),
@@ -164,7 +160,7 @@ void  local_search_analysis::start(branching_node* const  node_ptr, natural_32_b
     full_path.back().space_index = path.size();
     path.push_back({
             node,
-            node->get_best_trace()->at(node->get_trace_index()).value,
+            node->get_best_trace().at(node->get_trace_index()).value,
             node->is_direction_unexplored(false) ? false : true,
             node->is_direction_unexplored(false) ? opposite_predicate(node->get_branching_predicate()) : node->get_branching_predicate(),
             node->get_xor_like_branching_function(),
@@ -208,7 +204,7 @@ void  local_search_analysis::start(branching_node* const  node_ptr, natural_32_b
 
     ++statistics.start_calls;
 
-    recorder().on_local_search_start(node_ptr, progress_recorder::START::REGULAR);
+    recorder.on_local_search_start(node_ptr, progress_recorder::START::REGULAR);
 }
 
 
@@ -223,13 +219,13 @@ void  local_search_analysis::stop()
 
         ++statistics.stop_calls_early;
 
-        recorder().on_local_search_stop(progress_recorder::STOP::EARLY);
+        recorder.on_local_search_stop(progress_recorder::STOP::EARLY);
     }
     else
     {
         ++statistics.stop_calls_regular;
 
-        recorder().on_local_search_stop(progress_recorder::STOP::REGULAR);
+        recorder.on_local_search_stop(progress_recorder::STOP::REGULAR);
     }
 
     node->set_local_search_performed(execution_id);
@@ -238,6 +234,22 @@ void  local_search_analysis::stop()
 }
 
 
+void  local_search_analysis::save_checkpoint(checkpoint_writer&  writer) const
+{
+    writer.write(statistics);
+    writer.write_random_generator(rnd_generator);
+}
+
+
+void  local_search_analysis::load_checkpoint(checkpoint_reader&  reader)
+{
+    ASSUMPTION(is_ready());
+
+    reader.read(statistics);
+    reader.read_random_generator(rnd_generator);
+}
+
+
 void  local_search_analysis::stop_with_failure()
 {
     if (!is_busy())
@@ -251,11 +263,11 @@ void  local_search_analysis::stop_with_failure()
 
     ++statistics.stop_calls_failed;
 
-    recorder().on_local_search_stop(progress_recorder::STOP::FAILED);
+    recorder.on_local_search_stop(progress_recorder::STOP::FAILED);
 }
 
 
-bool  local_search_analysis::generate_next_input(vecb&  bits_ref)
+bool  local_search_analysis::generate_next_input(input_bits&  bits_ref)
 {
     TMPROF_BLOCK();
 
@@ -382,29 +394,28 @@ bool  local_search_analysis::generate_next_input(vecb&  bits_ref)
 
 
 void  local_search_analysis::process_execution_results(
-        execution_trace_pointer const  trace_ptr,
+        stored_execution_trace const&  trace,
         stdin_bits_and_types_pointer const  bits_and_types_ptr
         )
 {
     TMPROF_BLOCK();
 
     ASSUMPTION(is_busy());
-    ASSUMPTION(trace_ptr != nullptr);
 
     ++num_executions;
 
     execution_props.bits_and_types_ptr = bits_and_types_ptr;
     execution_props.values.clear();
 
-    for (std::size_t  i = 0UL, n = std::min({ full_path.size(), trace_ptr->size() }); i != n; ++i)
+    for (std::size_t  i = 0UL, n = std::min({ full_path.size(), trace.size() }); i != n; ++i)
     {
-        if (trace_ptr->at(i).id != full_path.at(i).id)
+        if (trace.at(i).id != full_path.at(i).id)
             break;
 
         if (full_path.at(i).space_index == execution_props.values.size())
-            execution_props.values.push_back(cast_float_value<float_64_bit>(trace_ptr->at(i).value));
+            execution_props.values.push_back(cast_float_value<float_64_bit>(trace.at(i).value));
 
-        if (i + 1UL < full_path.size() && trace_ptr->at(i).direction != full_path.at(i).direction)
+        if (i + 1UL < full_path.size() && trace.at(i).direction != full_path.at(i).direction)
             break;
     }
 
@@ -1289,29 +1300,32 @@ void  local_search_analysis::commit_execution_results(
 }
 
 
-void  local_search_analysis::bits_to_point(vecb const&  bits, vecf64&  point)
+void  local_search_analysis::bits_to_point(input_bits const&  bits, vecf64&  point)
 {
     point.clear();
     for (std::size_t  i = 0UL, i_end = (natural_32_bit)from_variables_to_input.size(); i != i_end; ++i)
     {
         number_overlay  value;
         mapping_to_input_bits const&  mapping = from_variables_to_input.at(i);
-        for (natural_8_bit  idx : mapping.value_bit_indices)
-            set_bit((natural_8_bit*)&value, idx, bits.at(mapping.input_start_bit_index + idx));
+        value._uint64 = bits.load_word(mapping.input_start_bit_index, num_bytes(types_of_variables.at(i))) & mapping.value_bits_mask;
         point.push_back(as<float_64_bit>(value, types_of_variables.at(i)));
     }
 }
 
 
-vector_overlay  local_search_analysis::point_to_bits(vecf64 const&  point, vecb&  bits)
+vector_overlay  local_search_analysis::point_to_bits(vecf64 const&  point, input_bits&  bits)
 {
     vector_overlay const  point_overlay{ make_vector_overlay(point, types_of_variables) };
     bits = bits_and_types->bits;
     for (std::size_t  i = 0ULL; i != point_overlay.size(); ++i)
     {
         mapping_to_input_bits const&  mapping = from_variables_to_input.at(i);
-        for (natural_8_bit  idx : mapping.value_bit_indices)
-            bits.at(mapping.input_start_bit_index + idx) = get_bit((natural_8_bit const*)&point_overlay.at(i), idx);
+        bits.store_word(
+                mapping.input_start_bit_index,
+                num_bytes(types_of_variables.at(i)),
+                point_overlay.at(i)._uint64,
+                mapping.value_bits_mask
+                );
     }
     return point_overlay;
 }
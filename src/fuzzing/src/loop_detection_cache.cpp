@@ -0,0 +1,122 @@
+#include <fuzzing/loop_detection_cache.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <utility/timeprof.hpp>
+#include <vector>
+
+namespace  fuzzing {
+
+
+loop_detection_cache::loop_detection_cache()
+    : summaries{}
+    , empty_summary{ std::make_shared<summary const>(summary{ nullptr, {}, 0U }) }
+    , statistics{}
+{}
+
+
+void  loop_detection_cache::compute_loop_heads_to_bodies(
+        branching_node* const  end_node,
+        loop_heads_to_bodies_map&  loop_heads_to_bodies
+        )
+{
+    TMPROF_BLOCK();
+
+    ASSUMPTION(end_node != nullptr);
+
+    ++statistics.queries;
+
+    for (summary const*  s = get_summary(end_node).get(); s != nullptr; s = s->base.get())
+        for (auto const&  head_and_body : s->loop_heads_to_bodies)
+            loop_heads_to_bodies[head_and_body.first].insert(head_and_body.second.begin(), head_and_body.second.end());
+}
+
+
+loop_detection_cache::summary_pointer  loop_detection_cache::get_summary(branching_node* const  node)
+{
+    if (node == nullptr)
+        return empty_summary;
+
+    auto const  it = summaries.find(node);
+    if (it != summaries.end())
+        return it->second;
+
+    // The summary of a node depends on the summary of its previous occurrence (or of its
+    // predecessor). We first collect the nodes without the summary along these dependencies
+    // and then we compute their summaries in the reverse order (to avoid a deep recursion).
+    std::vector<branching_node*>  work_list;
+    for (branching_node*  n = node; n != nullptr && !summaries.contains(n); )
+    {
+        work_list.push_back(n);
+        n = n->get_previous_occurrence() != nullptr ? n->get_previous_occurrence() : n->get_predecessor();
+    }
+    while (!work_list.empty())
+    {
+        summaries.insert({ work_list.back(), compute_summary(work_list.back()) });
+        work_list.pop_back();
+    }
+
+    return summaries.at(node);
+}
+
+
+loop_detection_cache::summary_pointer  loop_detection_cache::compute_summary(branching_node* const  node)
+{
+    branching_node* const  prev{ node->get_previous_occurrence() };
+    if (prev == nullptr)
+    {
+        // The location of the node does not appear anywhere below it, so the node
+        // stays at the bottom of the stack and it does not affect the exploration.
+        auto const  it = summaries.find(node->get_predecessor());
+        return it == summaries.end() ? empty_summary : it->second;
+    }
+
+    ASSUMPTION(prev->get_location_id() == node->get_location_id());
+
+    ++statistics.summaries_computed;
+
+    summary  result{ summaries.at(prev), {}, 0U };
+    result.chain_length = result.base->chain_length + 1U;
+
+    // The same exploration as in 'fuzzer::detect_loops_along_path_to_node', restricted
+    // to the nodes strictly between 'node' and 'prev'.
+    std::vector<location_id>  branching_stack;
+    std::unordered_map<location_id, natural_32_bit>  pointers_to_branching_stack;
+    for (branching_node*  n = node->get_predecessor(); n != prev; n = n->get_predecessor())
+    {
+        INVARIANT(n != nullptr);
+        ++statistics.nodes_walked;
+        auto const  it = pointers_to_branching_stack.find(n->get_location_id());
+        if (it == pointers_to_branching_stack.end())
+        {
+            pointers_to_branching_stack.insert({ n->get_location_id(), (natural_32_bit)branching_stack.size() });
+            branching_stack.push_back(n->get_location_id());
+        }
+        else
+        {
+            auto&  loop_body = result.loop_heads_to_bodies[n->get_location_id()];
+            for (std::size_t  end_size = it->second + 1ULL; branching_stack.size() > end_size; )
+            {
+                loop_body.insert(branching_stack.back());
+                pointers_to_branching_stack.erase(branching_stack.back());
+                branching_stack.pop_back();
+            }
+        }
+    }
+    // Reaching 'prev' pops the whole stack to the body of the loop headed by the node.
+    result.loop_heads_to_bodies[node->get_location_id()].insert(branching_stack.begin(), branching_stack.end());
+
+    if (result.chain_length > MAX_CHAIN_LENGTH)
+    {
+        for (summary const*  s = result.base.get(); s != nullptr; s = s->base.get())
+            for (auto const&  head_and_body : s->loop_heads_to_bodies)
+                result.loop_heads_to_bodies[head_and_body.first].insert(head_and_body.second.begin(), head_and_body.second.end());
+        result.base = nullptr;
+        result.chain_length = 0U;
+        ++statistics.summaries_compacted;
+    }
+
+    return std::make_shared<summary const>(std::move(result));
+}
+
+
+}
@@ -1,5 +1,6 @@
 #include <fuzzing/optimizer.hpp>
 #include <fuzzing/optimization_outcomes.hpp>
+#include <fuzzing/coverage_state.hpp>
 #include <iomodels/iomanager.hpp>
 #include <utility/std_pair_hash.hpp>
 #include <utility/assumptions.hpp>
@@ -11,8 +12,9 @@
 namespace  fuzzing {
 
 
-optimizer::optimizer(configuration const&  cfg)
-    : config{ cfg }
+optimizer::optimizer(campaign_context&  context_, configuration const&  cfg)
+    : context{ context_ }
+    , config{ cfg }
 
     , time_point_start{}
     , time_point_current{}
@@ -41,12 +43,11 @@ optimization_outcomes  optimizer::run(
     if (!inputs_leading_to_boundary_violation.empty())
     {
 
-        std::unordered_set<location_id>  covered_branchings{
-                already_covered_branchings.begin(), already_covered_branchings.end()
-                };
-        std::unordered_set<branching_location_and_direction>  uncovered_branchings{
-                already_uncovered_branchings.begin(), already_uncovered_branchings.end()
-                };
+        coverage_state  coverage;
+        for (location_id const  id : already_covered_branchings)
+            coverage.insert_covered(id);
+        for (branching_location_and_direction const&  loc_and_dir : already_uncovered_branchings)
+            coverage.insert_uncovered(loc_and_dir.first, loc_and_dir.second);
 
         std::unordered_set<location_id>  extra_covered_branchings;
         std::unordered_set<branching_location_and_direction>  extra_uncovered_branchings;
@@ -60,9 +61,9 @@ optimization_outcomes  optimizer::run(
                 break;
             }
 
-            iomodels::iomanager::instance().get_stdin()->clear();
-            iomodels::iomanager::instance().get_stdout()->clear();
-            iomodels::iomanager::instance().get_stdin()->set_bytes(stdin_bytes);
+            context.io.get_stdin()->clear();
+            context.io.get_stdout()->clear();
+            context.io.get_stdin()->set_bytes(stdin_bytes);
 
             try
             {
@@ -80,32 +81,23 @@ optimization_outcomes  optimizer::run(
             bool  trace_any_location_discovered = false;
             std::unordered_set<location_id>  trace_covered_branchings;
             {
-                for (branching_coverage_info const&  info : iomodels::iomanager::instance().get_trace())
+                for (branching_coverage_info const&  info : context.io.get_trace())
                 {
-                    if (!covered_branchings.contains(info.id))
+                    switch (coverage.visit(info.id, info.direction))
                     {
-                        auto const  it_along = uncovered_branchings.find({ info.id, info.direction });
-                        if (it_along == uncovered_branchings.end())
-                        {
-                            auto const  it_escape = uncovered_branchings.find({ info.id, !info.direction });
-                            if (it_escape == uncovered_branchings.end())
-                            {
-                                extra_uncovered_branchings.insert({ info.id, !info.direction });
-                                trace_any_location_discovered = true;
-
-                                uncovered_branchings.insert({ info.id, !info.direction });
-                            }
-                        }
-                        else
-                        {
-                            extra_uncovered_branchings.erase(*it_along);
+                        case coverage_state::ALREADY_COVERED:
+                        case coverage_state::STILL_UNCOVERED:
+                            break;
+                        case coverage_state::DISCOVERED:
+                            extra_uncovered_branchings.insert({ info.id, !info.direction });
+                            trace_any_location_discovered = true;
+                            break;
+                        case coverage_state::COVERED:
+                            extra_uncovered_branchings.erase({ info.id, info.direction });
                             extra_covered_branchings.insert(info.id);
-
                             trace_covered_branchings.insert(info.id);
-
-                            uncovered_branchings.erase(it_along);
-                            covered_branchings.insert(info.id);
-                        }
+                            break;
+                        default: { UNREACHABLE(); break; }
                     }
                 }
             }
@@ -114,13 +106,13 @@ optimization_outcomes  optimizer::run(
             {
                 exe_flags = 0;
 
-                if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::crash)
+                if (context.io.get_termination() == instrumentation::target_termination::crash)
                     exe_flags |= execution_record::EXECUTION_CRASHES;
 
-                if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::boundary_condition_violation)
+                if (context.io.get_termination() == instrumentation::target_termination::boundary_condition_violation)
                     exe_flags |= execution_record::BOUNDARY_CONDITION_VIOLATION;
 
-                if (iomodels::iomanager::instance().get_termination() == instrumentation::target_termination::medium_overflow)
+                if (context.io.get_termination() == instrumentation::target_termination::medium_overflow)
                     exe_flags |= execution_record::MEDIUM_OVERFLOW;
 
                 if (trace_any_location_discovered)
@@ -138,10 +130,10 @@ optimization_outcomes  optimizer::run(
                 execution_record record;
                 {
                     record.flags |= exe_flags;
-                    record.stdin_bytes = iomodels::iomanager::instance().get_stdin()->get_bytes();
-                    record.stdin_types = iomodels::iomanager::instance().get_stdin()->get_types();
+                    record.stdin_bytes = context.io.get_stdin()->get_bytes();
+                    record.stdin_types = context.io.get_stdin()->get_types();
                     record.path.clear();
-                    for (branching_coverage_info const&  info : iomodels::iomanager::instance().get_trace())
+                    for (branching_coverage_info const&  info : context.io.get_trace())
                         record.path.push_back({ info.id, info.direction });
                 }
 
@@ -37,15 +37,10 @@ static bool  copy_file(
 namespace fuzzing {
 
 
-progress_recorder& progress_recorder::instance()
-{
-    static progress_recorder rec;
-    return rec;
-}
-
+progress_recorder::progress_recorder(iomodels::iomanager const&  io_)
+    : io{ io_ }
 
-progress_recorder::progress_recorder()
-    : started{ false }
+    , started{ false }
 
     , output_dir{}
     , program_name{}
@@ -86,6 +81,8 @@ void  progress_recorder::start(std::filesystem::path const&  path_to_client_, st
     copy_file(input_dir, program_name + "_instrumented.ll", "source.ll", output_dir);
     copy_file(input_dir, program_name + "_dbg_cond_map.json", "cond_map.json", output_dir);
     copy_file(input_dir, program_name + "_dbg_br_map.json", "br_map.json", output_dir);
+    copy_file(input_dir, program_name + "_dbg_cond_map.bin", "cond_map.bin", output_dir, false);
+    copy_file(input_dir, program_name + "_dbg_br_map.bin", "br_map.bin", output_dir, false);
 
     started = true;
 
@@ -314,7 +311,7 @@ void  progress_recorder::on_input_generated()
 {
     if (!is_started())
         return;
-    num_bytes = (natural_32_bit)iomodels::iomanager::instance().get_stdin()->get_bytes().size();
+    num_bytes = (natural_32_bit)io.get_stdin()->get_bytes().size();
 }
 
 
@@ -336,7 +333,7 @@ void  progress_recorder::on_execution_results_available()
     auto const  ostr_ptr{ save_default_execution_results() };
     std::ofstream&  ostr{ *ostr_ptr };
 
-    vecu8 const&  bytes = iomodels::iomanager::instance().get_stdin()->get_bytes();
+    vecu8 const&  bytes = io.get_stdin()->get_bytes();
 
     ostr << "\"num_generated_input_bytes\": " << num_bytes << ",\n\"num_obtained_input_bytes\": " << bytes.size() << ",\n"
          << "\"obtained_input_bytes\": [";
@@ -372,7 +369,7 @@ std::unique_ptr<std::ofstream>  progress_recorder::save_default_execution_result
 
     std::ofstream&  ostr{ *ostr_ptr }; 
 
-    execution_trace const&  trace = iomodels::iomanager::instance().get_trace();
+    execution_trace const&  trace = io.get_trace();
 
     std::vector<branching_node::guid_type>  node_guids;
     for (branching_node const* n = leaf; n != nullptr; n = n->get_predecessor())
@@ -385,7 +382,7 @@ std::unique_ptr<std::ofstream>  progress_recorder::save_default_execution_result
 
     ostr << "\"trace_termination\": \"";
 
-    switch (iomodels::iomanager::instance().get_termination())
+    switch (io.get_termination())
     {
     case instrumentation::target_termination::normal: ostr << "NORMAL"; break;
     case instrumentation::target_termination::crash: ostr << "CRASH"; break;
@@ -504,9 +501,7 @@ void  progress_recorder::taint_response_progress_info::save_info(std::ostream&
         branching_node const* const  n = nodes.at(i);
         ostr << '[';
         bool first = true;
-        std::vector<natural_32_bit>  indices(n->get_sensitive_stdin_bits().begin(), n->get_sensitive_stdin_bits().end());
-        std::sort(indices.begin(), indices.end());
-        for (natural_32_bit idx : indices)
+        for (natural_32_bit idx : n->get_sensitive_stdin_bits())
         {
             if (!first) ostr << ',';
             ostr << idx;
@@ -74,8 +74,8 @@ void fuzzer::render() const
     RENDER("\"renderer\": {");
     RENDER("    \"elapsed_seconds\": " << get_elapsed_seconds() << ",");
     RENDER("    \"num_driver_executions\": " << num_driver_executions << ",");
-    RENDER("    \"covered_branchings\": " << covered_branchings.size() << ",");
-    RENDER("    \"uncovered_branchings\": " << uncovered_branchings.size() << ",");
+    RENDER("    \"covered_branchings\": " << coverage.num_covered() << ",");
+    RENDER("    \"uncovered_branchings\": " << coverage.num_uncovered() << ",");
     RENDER("    \"state\": \"" << get_analysis_name_from_state(state) << "\",");
     RENDER("    \"coverage_control\": {");
     RENDER("        \"interrupted\": " << coverage_control.is_analysis_interrupted() << ",");
@@ -84,6 +84,7 @@ void fuzzer::render() const
     RENDER("    },");
     RENDER("    \"bitshare_analysis\": " << get_bitshare_statistics().generated_inputs << ",");
     RENDER("    \"local_search_analysis\": " << get_local_search_statistics().generated_inputs << ",");
+    RENDER("    \"input_to_state_analysis\": " << get_input_to_state_statistics().generated_inputs << ",");
     RENDER("    \"bitflip_analysis\": " << get_bitflip_statistics().generated_inputs << ",");
     RENDER("    \"leaf_branchings\": " << leaf_branchings.size() << ",");
     RENDER("    \"tree_nodes\": " << get_fuzzer_statistics().nodes_created - get_fuzzer_statistics().nodes_destroyed << ",");
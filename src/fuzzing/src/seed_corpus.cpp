@@ -0,0 +1,216 @@
+#include <fuzzing/seed_corpus.hpp>
+#include <fuzzing/instrumentation_types.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <boost/json.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace  fuzzing {
+
+
+static bool  read_file(std::filesystem::path const&  pathname, std::string&  content)
+{
+    std::ifstream  istr(pathname.c_str(), std::ios::binary);
+    if (!istr.is_open())
+        return false;
+    std::stringstream  sstr;
+    sstr << istr.rdbuf();
+    content = sstr.str();
+    return true;
+}
+
+
+static std::string  trim(std::string const&  text)
+{
+    std::size_t const  begin{ text.find_first_not_of(" \t\r\n") };
+    if (begin == std::string::npos)
+        return {};
+    return text.substr(begin, text.find_last_not_of(" \t\r\n") + 1UL - begin);
+}
+
+
+static bool  type_from_c_type_string(std::string const&  name, type_of_input_bits&  type)
+{
+    for (natural_8_bit  id = to_id(type_of_input_bits::BOOLEAN);
+            id <= to_id(type_of_input_bits::FLOAT64);
+            ++id)
+        if (name == to_c_type_string(instrumentation::from_id(id)))
+        {
+            type = instrumentation::from_id(id);
+            return true;
+        }
+    // Other spellings of types used in Test-Comp tests.
+    static std::unordered_map<std::string, type_of_input_bits> const  aliases{
+        { "_Bool", type_of_input_bits::BOOLEAN },
+        { "signed char", type_of_input_bits::SINT8 },
+        { "unsigned", type_of_input_bits::UINT32 },
+        { "long long", type_of_input_bits::SINT64 },
+        { "unsigned long long", type_of_input_bits::UINT64 },
+    };
+    auto const  it = aliases.find(name);
+    if (it == aliases.end())
+        return false;
+    type = it->second;
+    return true;
+}
+
+
+template<typename T>
+static void  append_bytes(T const  value, vecu8&  bytes)
+{
+    natural_8_bit  value_bytes[sizeof(T)];
+    std::memcpy(value_bytes, &value, sizeof(T));
+    bytes.insert(bytes.end(), value_bytes, value_bytes + sizeof(T));
+}
+
+
+static bool  append_value(std::string const&  text, type_of_input_bits const  type, vecu8&  bytes)
+{
+    std::size_t  num_parsed{ 0UL };
+    try
+    {
+        if (is_floating_point_type(type))
+        {
+            long double const  value{ std::stold(text, &num_parsed) };
+            if (type == type_of_input_bits::FLOAT32)
+                append_bytes((float_32_bit)value, bytes);
+            else
+                append_bytes((float_64_bit)value, bytes);
+        }
+        else
+        {
+            // Negative values of unsigned types are taken modulo the size of the type, as in C.
+            natural_64_bit const  value{ text.starts_with('-') ?
+                    (natural_64_bit)std::stoll(text, &num_parsed, 0) :
+                    std::stoull(text, &num_parsed, 0)
+                    };
+            switch (num_bytes(type))
+            {
+                case 1U: append_bytes((natural_8_bit)(type == type_of_input_bits::BOOLEAN ? value != 0ULL : value), bytes); break;
+                case 2U: append_bytes((natural_16_bit)value, bytes); break;
+                case 4U: append_bytes((natural_32_bit)value, bytes); break;
+                case 8U: append_bytes(value, bytes); break;
+                default: { UNREACHABLE(); break; }
+            }
+        }
+    }
+    catch (std::exception const&)
+    {
+        return false;
+    }
+    return num_parsed == text.size();
+}
+
+
+bool  load_native_test_input(std::filesystem::path const&  pathname, vecu8&  stdin_bytes)
+{
+    std::string  content;
+    if (!read_file(pathname, content))
+        return false;
+
+    boost::json::error_code  ec;
+    boost::json::value const  json = boost::json::parse(content, ec);
+    if (ec || !json.is_object())
+        return false;
+
+    boost::json::value const* const  bytes_value = json.as_object().if_contains("bytes");
+    if (bytes_value == nullptr || !bytes_value->is_array())
+        return false;
+
+    vecu8  result;
+    for (boost::json::value const&  byte_value : bytes_value->as_array())
+    {
+        if (!byte_value.is_string())
+            return false;
+        std::string const  text{ byte_value.as_string().c_str() };
+        std::size_t  num_parsed{ 0UL };
+        unsigned long  value{ 0UL };
+        try { value = std::stoul(text, &num_parsed, 16); } catch (std::exception const&) { return false; }
+        if (num_parsed != text.size() || value > 0xffUL)
+            return false;
+        result.push_back((natural_8_bit)value);
+    }
+
+    stdin_bytes.swap(result);
+    return true;
+}
+
+
+bool  load_testcomp_test_input(std::filesystem::path const&  pathname, vecu8&  stdin_bytes)
+{
+    std::string  content;
+    if (!read_file(pathname, content))
+        return false;
+
+    if (content.find("<testcase") == std::string::npos)
+        return false;
+
+    vecu8  result;
+    for (std::size_t  pos = content.find("<input"); pos != std::string::npos; pos = content.find("<input", pos))
+    {
+        std::size_t const  tag_end{ content.find('>', pos) };
+        if (tag_end == std::string::npos)
+            return false;
+        std::string const  tag{ content.substr(pos, tag_end - pos) };
+
+        type_of_input_bits  type{ type_of_input_bits::SINT32 };
+        std::size_t const  type_begin{ tag.find("type=\"") };
+        if (type_begin != std::string::npos)
+        {
+            std::size_t const  name_begin{ type_begin + 6UL };
+            std::size_t const  name_end{ tag.find('"', name_begin) };
+            if (name_end == std::string::npos || !type_from_c_type_string(tag.substr(name_begin, name_end - name_begin), type))
+                return false;
+        }
+
+        std::size_t const  value_end{ content.find("</input>", tag_end) };
+        if (value_end == std::string::npos)
+            return false;
+        if (!append_value(trim(content.substr(tag_end + 1UL, value_end - tag_end - 1UL)), type, result))
+            return false;
+
+        pos = value_end;
+    }
+
+    stdin_bytes.swap(result);
+    return true;
+}
+
+
+std::size_t  load_seed_inputs(std::filesystem::path const&  seed_dir, std::vector<vecu8>&  inputs)
+{
+    std::vector<std::filesystem::path>  pathnames;
+    for (auto const&  entry : std::filesystem::recursive_directory_iterator(seed_dir))
+        if (entry.is_regular_file())
+            pathnames.push_back(entry.path());
+    std::sort(pathnames.begin(), pathnames.end());
+
+    std::unordered_set<std::string>  loaded_inputs;
+    std::size_t  num_skipped{ 0UL };
+    for (std::filesystem::path const&  pathname : pathnames)
+    {
+        vecu8  stdin_bytes;
+        bool  loaded{ false };
+        if (pathname.extension() == ".json")
+            loaded = load_native_test_input(pathname, stdin_bytes);
+        else if (pathname.extension() == ".xml")
+            loaded = load_testcomp_test_input(pathname, stdin_bytes);
+        if (!loaded)
+        {
+            ++num_skipped;
+            continue;
+        }
+        if (loaded_inputs.insert(std::string{ stdin_bytes.begin(), stdin_bytes.end() }).second)
+            inputs.push_back(std::move(stdin_bytes));
+    }
+    return num_skipped;
+}
+
+
+}
@@ -0,0 +1,120 @@
+#include <fuzzing/stdin_bit_set.hpp>
+#include <utility/assumptions.hpp>
+#include <utility/invariants.hpp>
+#include <algorithm>
+
+namespace  fuzzing {
+
+
+bool  stdin_bit_set::contains(stdin_bit_index const  idx) const
+{
+    auto const  it = std::upper_bound(
+            ranges_.begin(), ranges_.end(), idx, [](stdin_bit_index const  i, range const&  r) { return i < r.begin; }
+            );
+    return it != ranges_.begin() && idx < std::prev(it)->end;
+}
+
+
+bool  stdin_bit_set::intersects(stdin_bit_set const&  other) const
+{
+    auto  it = ranges_.begin();
+    auto  other_it = other.ranges_.begin();
+    while (it != ranges_.end() && other_it != other.ranges_.end())
+    {
+        if (it->end <= other_it->begin)
+            ++it;
+        else if (other_it->end <= it->begin)
+            ++other_it;
+        else
+            return true;
+    }
+    return false;
+}
+
+
+bool  stdin_bit_set::insert(stdin_bit_index const  begin, stdin_bit_index const  end)
+{
+    ASSUMPTION(begin <= end);
+
+    if (begin == end)
+        return false;
+
+    // The first range which overlaps or touches [begin, end).
+    auto const  first = std::lower_bound(
+            ranges_.begin(), ranges_.end(), begin, [](range const&  r, stdin_bit_index const  i) { return r.end < i; }
+            );
+    if (first != ranges_.end() && first->begin <= begin && end <= first->end)
+        return false;
+
+    range  merged{ begin, end };
+    std::size_t  num_merged_bits{ 0UL };
+    auto  last = first;
+    for ( ; last != ranges_.end() && last->begin <= end; ++last)
+    {
+        merged.begin = std::min(merged.begin, last->begin);
+        merged.end = std::max(merged.end, last->end);
+        num_merged_bits += last->end - last->begin;
+    }
+
+    if (first == last)
+        ranges_.insert(first, merged);
+    else
+    {
+        *first = merged;
+        ranges_.erase(std::next(first), last);
+    }
+
+    num_bits += (merged.end - merged.begin) - num_merged_bits;
+
+    return true;
+}
+
+
+bool  stdin_bit_set::unite(stdin_bit_set const&  other)
+{
+    if (other.empty())
+        return false;
+    if (empty())
+    {
+        *this = other;
+        return true;
+    }
+
+    std::vector<range>  result;
+    result.reserve(ranges_.size() + other.ranges_.size());
+    std::size_t  result_num_bits{ 0UL };
+
+    auto const  push = [&result, &result_num_bits](range const&  r) {
+        if (!result.empty() && r.begin <= result.back().end)
+        {
+            if (result.back().end < r.end)
+            {
+                result_num_bits += r.end - result.back().end;
+                result.back().end = r.end;
+            }
+        }
+        else
+        {
+            result.push_back(r);
+            result_num_bits += r.end - r.begin;
+        }
+    };
+
+    auto  it = ranges_.begin();
+    auto  other_it = other.ranges_.begin();
+    while (it != ranges_.end() || other_it != other.ranges_.end())
+        if (other_it == other.ranges_.end() || (it != ranges_.end() && it->begin < other_it->begin))
+            push(*it++);
+        else
+            push(*other_it++);
+
+    INVARIANT(result_num_bits >= num_bits);
+
+    bool const  changed{ result_num_bits != num_bits };
+    ranges_.swap(result);
+    num_bits = result_num_bits;
+    return changed;
+}
+
+
+}
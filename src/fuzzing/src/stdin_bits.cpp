@@ -6,10 +6,18 @@ namespace  fuzzing {
 
 stdin_bits_and_types::stdin_bits_and_types(vecu8 const&  bytes_, vect const&  types_)
     : bits{}
-    , types{ types_ }
+    , types{}
     , bit_end_indices_of_types{}
 {
-    bytes_to_bits(bytes_, bits);
+    assign(bytes_, types_);
+}
+
+
+void  stdin_bits_and_types::assign(vecu8 const&  bytes_, vect const&  types_)
+{
+    clear();
+    types.assign(types_.begin(), types_.end());
+    bits.assign_bytes(bytes_);
     natural_32_bit  idx = 0U;
     bit_end_indices_of_types.reserve(types.size());
     for (type_of_input_bits  type : types)
@@ -21,6 +29,14 @@ stdin_bits_and_types::stdin_bits_and_types(vecu8 const&  bytes_, vect const&  ty
 }
 
 
+void  stdin_bits_and_types::clear()
+{
+    bits.clear();
+    types.clear();
+    bit_end_indices_of_types.clear();
+}
+
+
 natural_32_bit  stdin_bits_and_types::type_index(natural_32_bit const  bit_index) const
 {
     ASSUMPTION(bit_index < (natural_32_bit)bits.size());
@@ -0,0 +1,49 @@
+#include <fuzzing/target_metadata.hpp>
+#include <boost/json.hpp>
+#include <fstream>
+#include <sstream>
+
+namespace  fuzzing {
+
+
+bool  load_target_metadata(std::filesystem::path const&  pathname, target_metadata&  metadata)
+{
+    std::ifstream  istr(pathname.c_str(), std::ios::binary);
+    if (!istr.is_open())
+        return false;
+    std::stringstream  sstr;
+    sstr << istr.rdbuf();
+
+    boost::json::error_code  ec;
+    boost::json::value const  json = boost::json::parse(sstr.str(), ec);
+    if (ec || !json.is_object())
+        return false;
+
+    boost::json::object const&  obj = json.as_object();
+    target_metadata  result;
+    for (auto const&  [key, field] : std::initializer_list<std::pair<char const*, natural_32_bit*> >{
+            { "num_cond_locations", &result.num_cond_locations },
+            { "num_br_locations", &result.num_br_locations },
+            { "num_call_sites", &result.num_call_sites } })
+    {
+        boost::json::value const* const  value = obj.if_contains(key);
+        if (value == nullptr || !value->is_number())
+            return false;
+        *field = value->to_number<natural_32_bit>(ec);
+        if (ec)
+            return false;
+    }
+    if (boost::json::value const* const  value = obj.if_contains("num_cmp_operands_sites"))
+    {
+        if (!value->is_number())
+            return false;
+        result.num_cmp_operands_sites = value->to_number<natural_32_bit>(ec);
+        if (ec)
+            return false;
+    }
+    metadata = result;
+    return true;
+}
+
+
+}
@@ -10,7 +10,8 @@ enum class data_record_id: natural_8_bit {
     termination     = 1,
     condition       = 2,
     br_instr        = 3,
-    stdin_bytes     = 4
+    stdin_bytes     = 4,
+    cmp_operands    = 5
 };
 
 }
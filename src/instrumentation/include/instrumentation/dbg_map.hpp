@@ -0,0 +1,56 @@
+#ifndef INSTRUMENTATION_DBG_MAP_HPP_INCLUDED
+#   define INSTRUMENTATION_DBG_MAP_HPP_INCLUDED
+
+#   include <utility/basic_numeric_types.hpp>
+#   include <filesystem>
+#   include <string>
+
+namespace  instrumentation {
+
+
+/*
+The binary counterpart of the '<program>_dbg_<type>_map.json' files written by the instrumenter.
+The file is mapped to memory as is; its layout (in the native byte order) is:
+    dbg_map_header
+    dbg_map_entry[num_entries]      sorted by 'id', so lookups are binary searches
+    char[names_size]                zero-terminated function names referenced from entries
+The file is written by the instrumenter and read by 'fuzzing::dbg_map' on the server side.
+*/
+
+struct  dbg_map_header
+{
+    static constexpr char  magic_value[8]{ 'S', 'B', 'T', 'F', 'D', 'B', 'G', 'M' };
+    static constexpr natural_32_bit  current_version{ 1U };
+
+    char  magic[8];
+    natural_32_bit  version;
+    natural_32_bit  num_entries;
+    natural_32_bit  names_size;
+    natural_32_bit  reserved;
+};
+
+
+struct  dbg_map_entry
+{
+    natural_32_bit  id;
+    natural_32_bit  line;
+    natural_32_bit  column;
+    natural_32_bit  basic_block;
+    natural_32_bit  shift;
+    natural_32_bit  function_name; // Offset into the names section.
+};
+
+
+inline std::filesystem::path  dbg_map_pathname(
+        std::filesystem::path const&  dir,
+        std::string const&  program_name,
+        std::string const&  type
+        )
+{
+    return dir / (program_name + "_dbg_" + type + "_map.bin");
+}
+
+
+}
+
+#endif
@@ -9,6 +9,7 @@
 #   include <instrumentation/instrumentation_types.hpp>
 #   include <connection/shared_memory.hpp>
 #   include <iomodels/stdin_base.hpp>
+#   include <iomodels/stdin_replay_bytes_then_repeat_byte.hpp>
 #   include <iomodels/stdout_void.hpp>
 #   include <iomodels/configuration.hpp>
 
@@ -24,6 +25,10 @@ class fuzz_target {
     iomodels::configuration config;
     iomodels::stdin_base_ptr stdin_model;
     iomodels::stdout_base_ptr stdout_model;
+    // Resolved once in load_config() for the built-in models, so that on_read and
+    // on_write bypass the vtable (nullptr/false means the generic virtual path).
+    iomodels::stdin_replay_bytes_then_repeat_byte* stdin_replay_model;
+    bool stdout_is_void;
     connection::shared_memory shared_memory;
 
 public:
@@ -37,6 +42,7 @@ public:
             bool xor_like_branching_function,
             natural_8_bit predicate
             );
+    void process_cmp_operands(natural_64_bit lhs, natural_64_bit rhs, natural_8_bit num_bytes);
     void process_br_instr(location_id id, bool covered_branch);
 
     void process_call_begin(natural_32_bit const  id);
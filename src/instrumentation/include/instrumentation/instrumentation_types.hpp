@@ -76,6 +76,21 @@ struct  br_instr_coverage_info
 };
 
 
+// The raw operands of an integer comparison, which was instrumented with the
+// instrumenter's option 'cmp_operands'. The record always immediately follows
+// the 'branching_coverage_info' record of the same comparison.
+struct  cmp_operands_info
+{
+    explicit cmp_operands_info(natural_32_bit const  trace_index_);
+    static std::size_t flattened_size();
+
+    natural_32_bit  trace_index; // Index of the related 'branching_coverage_info' in the trace.
+    natural_64_bit  lhs; // Zero-extended to 64 bits.
+    natural_64_bit  rhs; // Zero-extended to 64 bits.
+    natural_8_bit  num_bytes;
+};
+
+
 bool  is_same_branching(branching_coverage_info const&  l, branching_coverage_info const&  r);
 
 
@@ -19,6 +19,8 @@ fuzz_target::fuzz_target():
     , config{}
     , stdin_model{ nullptr }
     , stdout_model{ nullptr }
+    , stdin_replay_model{ nullptr }
+    , stdout_is_void{ false }
     , shared_memory{}
 {
     INVARIANT(context_hashes.size() == locations.size() + 1);
@@ -52,6 +54,23 @@ void fuzz_target::process_condition(
     ++trace_length;
 }
 
+void fuzz_target::process_cmp_operands(natural_64_bit const lhs, natural_64_bit const rhs, natural_8_bit const num_bytes) {
+    // Must mirror the early exit of process_condition(), so that the record gets attached to the right condition.
+    if (stdin_model->num_bytes_read() == 0)
+        return;
+
+    // The fuzzer did not reserve space for the records (it does not know the target passes them).
+    if (!config.cmp_operands)
+        return;
+
+    if (!shared_memory.can_accept_bytes(cmp_operands_info::flattened_size())) {
+        shared_memory.set_termination(target_termination::medium_overflow);
+        exit(0);
+    }
+
+    shared_memory << data_record_id::cmp_operands << lhs << rhs << num_bytes;
+}
+
 void fuzz_target::process_br_instr(location_id id, bool covered_branch) {
     if (stdin_model->num_bytes_read() == 0)
         return;
@@ -112,12 +131,18 @@ void fuzz_target::process_call_end(natural_32_bit const  id) {
 }
 
 void fuzz_target::on_read(natural_8_bit* ptr, type_of_input_bits const type) {
-    stdin_model->read(ptr, type, shared_memory);
+    if (stdin_replay_model != nullptr) {
+        if (!stdin_replay_model->read_bytes_direct(ptr, type, shared_memory))
+            exit(0);
+    }
+    else
+        stdin_model->read(ptr, type, shared_memory);
 }
 
 
 void fuzz_target::on_write(natural_8_bit const*  ptr, type_of_input_bits const type) {
-    stdout_model->write(ptr, type, shared_memory);
+    if (!stdout_is_void)
+        stdout_model->write(ptr, type, shared_memory);
 }
 
 
@@ -125,6 +150,8 @@ void fuzz_target::load_config() {
     config.load_target_config(shared_memory);
     stdin_model = get_stdin_models_map().at(config.stdin_model_name)(config.max_stdin_bytes);
     stdout_model = get_stdout_models_map().at(config.stdout_model_name)();
+    stdin_replay_model = dynamic_cast<stdin_replay_bytes_then_repeat_byte*>(stdin_model.get());
+    stdout_is_void = dynamic_cast<stdout_void*>(stdout_model.get()) != nullptr;
 }
 
 void fuzz_target::load_stdin() {
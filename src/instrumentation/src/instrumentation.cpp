@@ -18,6 +18,14 @@ void __sbt_fizzer_process_condition(
     sbt_fizzer_target->process_condition(id, direction, value, xor_like_branching_function, predicate);
 }
 
+void __sbt_fizzer_process_cmp_operands(
+        natural_64_bit const  lhs,
+        natural_64_bit const  rhs,
+        natural_8_bit const  num_bytes
+        ) {
+    sbt_fizzer_target->process_cmp_operands(lhs, rhs, num_bytes);
+}
+
 void __sbt_fizzer_process_br_instr(location_id::id_type const  id, bool const  direction) {
     sbt_fizzer_target->process_br_instr(id, direction);
 }
@@ -50,6 +50,21 @@ size_t br_instr_coverage_info::flattened_size() {
 }
 
 
+cmp_operands_info::cmp_operands_info(natural_32_bit const  trace_index_)
+    : trace_index{ trace_index_ }
+    , lhs{ 0ULL }
+    , rhs{ 0ULL }
+    , num_bytes{ 0U }
+{}
+
+size_t cmp_operands_info::flattened_size() {
+    return sizeof(lhs)
+                + sizeof(rhs)
+                + sizeof(num_bytes)
+                // + sizeof(trace_index) <---- This is not transmitted via shared memory!
+                ;
+}
+
 
 bool  is_same_branching(branching_coverage_info const&  l, branching_coverage_info const&  r)
 {
@@ -1,6 +1,7 @@
 #include <instrumentation/fuzz_target.hpp>
 #include <instrumentation/data_record_id.hpp>
 #include <sys/resource.h>
+#include <cstdlib>
 #include <iostream>
 
 extern "C" {
@@ -35,6 +36,8 @@ int main(int argc, char* argv[]) {
         }
     #endif
 
+    if (const char* segment_name = std::getenv(connection::shared_memory::segment_name_variable))
+        sbt_fizzer_target->get_shared_memory().set_segment_name(segment_name);
     sbt_fizzer_target->get_shared_memory().open_or_create();
     sbt_fizzer_target->get_shared_memory().map_region();
 
@@ -31,6 +31,7 @@ struct  configuration
 
     // used by sbt-fizzer_target
     natural_32_bit  max_trace_length { 10000 };
+    bool  cmp_operands { false }; // Whether records of cmp operands follow conditions (space is reserved for them).
     natural_32_bit  max_br_instr_trace_length { 30000 };
     natural_16_bit  max_stack_size { 25 };
     stdin_base::byte_count_type  max_stdin_bytes { 1800 }; // Standard page: 60 * 30 chars.
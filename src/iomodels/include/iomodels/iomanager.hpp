@@ -19,6 +19,13 @@ namespace  iomodels {
 
 struct  iomanager
 {
+    iomanager();
+
+    iomanager(iomanager const&) = delete;
+    iomanager&  operator=(iomanager const&) = delete;
+
+    // The one of the client process, which runs a single target. The server has an instance
+    // per fuzzing campaign instead (see 'fuzzing::campaign_context').
     static iomanager&  instance();
 
     configuration const&  get_config() const { return config; }
@@ -32,11 +39,15 @@ struct  iomanager
     template <typename Medium>
     bool  load_trace_record(Medium& src);
 
+    template <typename Medium>
+    bool  load_cmp_operands_record(Medium& src);
+
     template <typename Medium>
     bool  load_br_instr_trace_record(Medium& src);
 
     std::vector<instrumentation::branching_coverage_info> const&  get_trace() const { return trace; }
     void  clear_trace();
+    std::vector<instrumentation::cmp_operands_info> const&  get_cmp_operands_trace() const { return cmp_operands_trace; }
     std::vector<instrumentation::br_instr_coverage_info> const&  get_br_instr_trace() const { return br_instr_trace; }
     void  clear_br_instr_trace();
 
@@ -46,12 +57,27 @@ struct  iomanager
     stdin_base_ptr  clone_stdin() const;
     stdout_base_ptr  clone_stdout() const;
 
-private:
-    iomanager();
+    // A copy of the results of an execution of the target. Restoring it has the same effect
+    // as loading the results of a new execution of the target for the same input.
+    struct  execution_results
+    {
+        std::size_t  num_bytes() const;
+
+        instrumentation::target_termination  termination{ instrumentation::target_termination::normal };
+        std::vector<instrumentation::branching_coverage_info>  trace{};
+        std::vector<instrumentation::cmp_operands_info>  cmp_operands_trace{};
+        std::vector<instrumentation::br_instr_coverage_info>  br_instr_trace{};
+        connection::message  stdin_and_stdout{}; // As saved by the stdin and stdout models.
+    };
 
+    void  save_results(execution_results&  results) const;
+    void  restore_results(execution_results const&  results);
+
+private:
     configuration config;
     instrumentation::target_termination  termination;
     std::vector<instrumentation::branching_coverage_info>  trace;
+    std::vector<instrumentation::cmp_operands_info>  cmp_operands_trace;
     std::vector<instrumentation::br_instr_coverage_info>  br_instr_trace;
     mutable stdin_base_ptr  stdin_ptr;
     mutable stdout_base_ptr  stdout_ptr;
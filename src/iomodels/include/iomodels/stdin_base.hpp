@@ -32,6 +32,9 @@ struct  stdin_base
     virtual vecu8 const&  get_bytes() const = 0;
     virtual input_types_vector const&  get_types() const = 0;
     virtual byte_count_type  num_bytes_read() const = 0;
+    // The number of leading bytes of the input which determine the execution of the target.
+    // E.g. trailing bytes equal to those the model supplies past the end of the input do not.
+    virtual byte_count_type  num_effective_bytes() const { return (byte_count_type)get_bytes().size(); }
 
     virtual void  set_bytes(vecu8 const&  bytes) = 0;
 
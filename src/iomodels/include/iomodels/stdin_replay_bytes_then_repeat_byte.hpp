@@ -2,12 +2,15 @@
 #   define IOMODELS_STDIN_REPLAY_BYTES_THEN_REPEAT_BYTE_HPP_INCLUDED
 
 #   include <iomodels/stdin_base.hpp>
+#   include <instrumentation/data_record_id.hpp>
+#   include <instrumentation/target_termination.hpp>
 #   include <utility/math.hpp>
+#   include <cstring>
 
 namespace  iomodels {
 
 
-struct stdin_replay_bytes_then_repeat_byte : public stdin_base
+struct stdin_replay_bytes_then_repeat_byte final : public stdin_base
 {
     stdin_replay_bytes_then_repeat_byte(byte_count_type  max_bytes_, natural_8_bit repeat_byte);
 
@@ -21,13 +24,63 @@ struct stdin_replay_bytes_then_repeat_byte : public stdin_base
     std::size_t min_flattened_size() const override;
     bool  read_bytes(natural_8_bit*  ptr, type_of_input_bits  type, connection::medium&  dest) override;
 
+    // The same as 'read_bytes' but statically bound to the shared memory: the record is
+    // written directly behind the reserved pointer. Used by the target runtime, which calls
+    // it in tight loops.
+    bool  read_bytes_direct(natural_8_bit*  ptr, type_of_input_bits const  type, connection::shared_memory&  dest)
+    { return read_bytes_(ptr, type, dest); }
+
     vecu8 const&  get_bytes() const override { return bytes; }
     input_types_vector const&  get_types() const override { return types; }
     byte_count_type  num_bytes_read() const override { return cursor; }
+    byte_count_type  num_effective_bytes() const override;
 
     void  set_bytes(vecu8 const&  bytes_) override { bytes = bytes_; }
 
 private:
+    static bool  write_record(natural_8_bit const* const  record, std::size_t const  n, connection::shared_memory&  dest)
+    {
+        natural_8_bit* const  ptr = dest.reserve_bytes(n);
+        if (ptr == nullptr)
+            return false;
+        std::memcpy(ptr, record, n);
+        return true;
+    }
+    static bool  write_record(natural_8_bit const* const  record, std::size_t const  n, connection::medium&  dest)
+    {
+        if (!dest.can_accept_bytes(n))
+            return false;
+        dest.accept_bytes(record, n);
+        return true;
+    }
+
+    // Replays the bytes and then the repeat byte; shared by 'read_bytes' and 'read_bytes_direct'.
+    template <typename Medium>
+    bool  read_bytes_(natural_8_bit* const  ptr, type_of_input_bits const  type, Medium&  dest)
+    {
+        natural_8_bit const  count = instrumentation::num_bytes(type);
+        byte_count_type const  end = cursor + count;
+        if (end > max_bytes()) {
+            dest.set_termination(instrumentation::target_termination::boundary_condition_violation);
+            return false;
+        }
+        if (end > bytes.size())
+            bytes.resize(end, repeat_byte);
+        natural_8_bit const* const  src = bytes.data() + cursor;
+        natural_8_bit  record[2U + sizeof(natural_64_bit)];
+        record[0] = (natural_8_bit)instrumentation::data_record_id::stdin_bytes;
+        record[1] = instrumentation::to_id(type);
+        std::memcpy(record + 2, src, count);
+        if (!write_record(record, count + 2U, dest)) {
+            dest.set_termination(instrumentation::target_termination::medium_overflow);
+            return false;
+        }
+        std::memcpy(ptr, src, count);
+        cursor = end;
+        types.push_back(type);
+        return true;
+    }
+
     template <typename Medium>
     void  load_(Medium& src);
     template <typename Medium>
@@ -13,6 +13,7 @@ bool configuration::operator==(configuration const&  other) const
     return
         max_exec_milliseconds == other.max_exec_milliseconds &&     
         max_trace_length == other.max_trace_length &&
+        cmp_operands == other.cmp_operands &&
         max_stack_size == other.max_stack_size &&
         max_stdin_bytes == other.max_stdin_bytes &&
         max_exec_megabytes == other.max_exec_megabytes &&
@@ -33,13 +34,14 @@ natural_32_bit configuration::required_shared_memory_size() const {
     std::size_t const  data_id_size = sizeof(data_record_id);
     std::size_t const  termination_record_size = data_id_size + sizeof(target_termination);
     std::size_t const  branching_record_size = data_id_size + branching_coverage_info::flattened_size();
+    std::size_t const  cmp_operands_record_size = data_id_size + cmp_operands_info::flattened_size();
     std::size_t const  br_instr_record_size = data_id_size + br_instr_coverage_info::flattened_size();
     std::size_t const  stdin_min_size = data_id_size + iomodels::get_stdin_models_map().at(stdin_model_name)(max_stdin_bytes)->min_flattened_size();
 
     natural_32_bit const  result = (natural_32_bit) (
             flattened_size() +
             termination_record_size +
-            branching_record_size * max_trace_length +
+            (branching_record_size + (cmp_operands ? cmp_operands_record_size : 0U)) * max_trace_length +
             br_instr_record_size * max_br_instr_trace_length +
             stdin_min_size * max_stdin_bytes
             );
@@ -65,6 +67,7 @@ std::size_t configuration::flattened_size() {
     static std::size_t const  max_stdin_key_size = longest_key(iomodels::get_stdin_models_map());
     static std::size_t const  max_stdout_key_size = longest_key(iomodels::get_stdin_models_map());
     return  sizeof(max_trace_length) +
+            sizeof(cmp_operands) +
             sizeof(max_br_instr_trace_length) +
             sizeof(max_stack_size) +
             sizeof(max_stdin_bytes) +
@@ -77,6 +80,7 @@ std::size_t configuration::flattened_size() {
 template <typename Medium>
 void configuration::save_target_config(Medium& dest) const {
     dest << max_trace_length;
+    dest << cmp_operands;
     dest << max_br_instr_trace_length;
     dest << max_stack_size;
     dest << max_stdin_bytes;
@@ -91,6 +95,7 @@ template void configuration::save_target_config(connection::message&) const;
 template <typename Medium>
 void configuration::load_target_config(Medium& src) {
     src >> max_trace_length;
+    src >> cmp_operands;
     src >> max_br_instr_trace_length;
     src >> max_stack_size;
     src >> max_stdin_bytes;
@@ -18,6 +18,7 @@ iomanager::iomanager()
     : config{}
     , termination{ target_termination::normal }
     , trace()
+    , cmp_operands_trace()
     , br_instr_trace()
     , stdin_ptr(nullptr)
     , stdout_ptr(nullptr)
@@ -44,6 +45,7 @@ void  iomanager::set_config(configuration const&  cfg)
 void  iomanager::clear_trace()
 {
     trace.clear();
+    cmp_operands_trace.clear();
 }
 
 void  iomanager::clear_br_instr_trace()
@@ -73,6 +75,22 @@ template bool iomanager::load_trace_record(shared_memory&);
 template bool iomanager::load_trace_record(message&);
 
 
+template <typename Medium>
+bool  iomanager::load_cmp_operands_record(Medium& src) {
+    if (trace.empty() || !src.can_deliver_bytes(cmp_operands_info::flattened_size()))
+        return false;
+    cmp_operands_info  info { (natural_32_bit)(trace.size() - 1U) };
+    src >> info.lhs;
+    src >> info.rhs;
+    src >> info.num_bytes;
+    cmp_operands_trace.push_back(info);
+    return true;
+}
+
+template bool iomanager::load_cmp_operands_record(shared_memory&);
+template bool iomanager::load_cmp_operands_record(message&);
+
+
 template <typename Medium>
 bool  iomanager::load_br_instr_trace_record(Medium& src) {
     if (!src.can_deliver_bytes(br_instr_coverage_info::flattened_size()))
@@ -108,6 +126,10 @@ void  iomanager::load_results(Medium& src) {
                 if (load_trace_record(src) == false)
                     return; // Something went wrong => stop loading data.
                 break;
+            case data_record_id::cmp_operands:
+                if (load_cmp_operands_record(src) == false)
+                    return; // Something went wrong => stop loading data.
+                break;
             case data_record_id::br_instr:
                 if (load_br_instr_trace_record(src) == false)
                     return; // Something went wrong => stop loading data.
@@ -127,6 +149,46 @@ template void iomanager::load_results(shared_memory&);
 template void iomanager::load_results(message&);
 
 
+std::size_t  iomanager::execution_results::num_bytes() const
+{
+    return sizeof(execution_results)
+           + trace.size() * sizeof(branching_coverage_info)
+           + cmp_operands_trace.size() * sizeof(cmp_operands_info)
+           + br_instr_trace.size() * sizeof(br_instr_coverage_info)
+           + stdin_and_stdout.size();
+}
+
+
+void  iomanager::save_results(execution_results&  results) const
+{
+    TMPROF_BLOCK();
+
+    results.termination = termination;
+    results.trace = trace;
+    results.cmp_operands_trace = cmp_operands_trace;
+    results.br_instr_trace = br_instr_trace;
+    results.stdin_and_stdout.clear();
+    get_stdin()->save(results.stdin_and_stdout);
+    get_stdout()->save(results.stdin_and_stdout);
+}
+
+
+void  iomanager::restore_results(execution_results const&  results)
+{
+    TMPROF_BLOCK();
+
+    termination = results.termination;
+    trace = results.trace;
+    cmp_operands_trace = results.cmp_operands_trace;
+    br_instr_trace = results.br_instr_trace;
+    message  src{ results.stdin_and_stdout }; // A copy, because reading moves the cursor.
+    get_stdin()->clear();
+    get_stdin()->load(src);
+    get_stdout()->clear();
+    get_stdout()->load(src);
+}
+
+
 stdin_base*  iomanager::get_stdin() const
 {
     if (stdin_ptr == nullptr)
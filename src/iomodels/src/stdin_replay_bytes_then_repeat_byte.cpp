@@ -114,6 +114,16 @@ bool  stdin_replay_bytes_then_repeat_byte::load_record(shared_memory&  src) {
 }
 
 
+stdin_base::byte_count_type  stdin_replay_bytes_then_repeat_byte::num_effective_bytes() const
+{
+    // Reads past the end of the input get the repeat byte, so trailing repeat bytes do not matter.
+    byte_count_type  n = (byte_count_type)bytes.size();
+    while (n > 0U && bytes.at(n - 1U) == repeat_byte)
+        --n;
+    return n;
+}
+
+
 std::size_t stdin_replay_bytes_then_repeat_byte::min_flattened_size() const {
     return sizeof(input_types_vector::value_type) + 1;
 }
@@ -123,29 +133,7 @@ bool  stdin_replay_bytes_then_repeat_byte::read_bytes(
     natural_8_bit*  ptr, type_of_input_bits const  type, medium&  dest
     )
 {
-    natural_8_bit const count = num_bytes(type);
-    if (cursor + count > max_bytes()) {
-        dest.set_termination(target_termination::boundary_condition_violation);
-        return false;
-    }
-    if (!dest.can_accept_bytes(count + 2)) {
-        dest.set_termination(target_termination::medium_overflow);
-        return false;
-    }
-    if (cursor + count > bytes.size()) {
-        bytes.resize(cursor + count, repeat_byte);
-    }
-    memcpy(ptr, bytes.data() + cursor, count);
-    {
-        auto const rec_type{ data_record_id::stdin_bytes };
-        dest.accept_bytes(&rec_type, sizeof(rec_type));
-        auto const type_id{ to_id(type) };
-        dest.accept_bytes(&type_id, sizeof(type_id));
-    }
-    dest.accept_bytes(bytes.data() + cursor, count);
-    cursor += count;
-    types.push_back(type);
-    return true;
+    return read_bytes_(ptr, type, dest);
 }
 
 
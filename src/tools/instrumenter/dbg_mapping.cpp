@@ -0,0 +1,110 @@
+#include <instrumenter/dbg_mapping.hpp>
+#include <instrumentation/dbg_map.hpp>
+#include <utility/config.hpp>
+#if COMPILER() == COMPILER_VC()
+#    pragma warning(push)
+#    pragma warning(disable : 4624 4996 4146 4800 4996 4005 4355 4244 4267)
+#endif
+#include <llvm/IR/DebugInfo.h>
+#if COMPILER() == COMPILER_VC()
+#    pragma warning(pop)
+#endif
+#include <utility/timeprof.hpp>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+
+std::filesystem::path  dbg_mapping_pathname(
+        std::filesystem::path const&  output_dir,
+        std::string const&  benchmark_name,
+        std::string const&  type
+        )
+{
+    return output_dir / (benchmark_name + "_dbg_" + type + "_map.json");
+}
+
+
+void  save_dbg_mapping(
+        llvm_instrumenter::instruction_dbg_info_vector const&  mapping,
+        llvm_instrumenter::basic_block_dbg_info_map const&  bbInfo,
+        std::filesystem::path const&  pathname
+        )
+{
+    TMPROF_BLOCK();
+
+    std::ofstream  ostr(pathname.c_str(), std::ios::binary);
+    ostr << "{";
+    bool started { false }; 
+    for (auto const&  info : mapping) {
+        if (started) ostr << ','; else started = true;
+        llvm::DILocation const *dbgLoc = info.instruction->getDebugLoc();
+        if (dbgLoc == nullptr)
+            dbgLoc = bbInfo.at(info.instruction->getParent()).info;
+        if (dbgLoc == nullptr)
+        {
+            std::cerr << "Retrieval of debug information for the instruction #" << info.id << "has FAILED!\n";
+            continue;
+        }
+        ostr << '\n'
+                << '"' << info.id << "\": [ "
+                << dbgLoc->getLine() << ", "
+                << dbgLoc->getColumn() << ", "
+                << bbInfo.at(info.instruction->getParent()).id << ", "
+                << info.shift
+            << " ]"
+                ;
+    }
+    ostr << "\n}\n";
+}
+
+
+void  save_dbg_mapping_binary(
+        llvm_instrumenter::instruction_dbg_info_vector const&  mapping,
+        llvm_instrumenter::basic_block_dbg_info_map const&  bbInfo,
+        std::filesystem::path const&  pathname
+        )
+{
+    TMPROF_BLOCK();
+
+    std::vector<instrumentation::dbg_map_entry>  entries;
+    std::string  names;
+    std::unordered_map<std::string, std::uint32_t>  name_offsets;
+    for (auto const&  info : mapping) {
+        llvm::DILocation const *dbgLoc = info.instruction->getDebugLoc();
+        if (dbgLoc == nullptr)
+            dbgLoc = bbInfo.at(info.instruction->getParent()).info;
+        if (dbgLoc == nullptr)
+            continue;
+        // Functions were renamed by the instrumenter, so we prefer the name from debug info.
+        llvm::DISubprogram const *subprogram = dbgLoc->getScope()->getSubprogram();
+        std::string const  name{ subprogram != nullptr ? subprogram->getName() : info.instruction->getFunction()->getName() };
+        auto const  it_and_state = name_offsets.insert({ name, (std::uint32_t)names.size() });
+        if (it_and_state.second) {
+            names.append(name);
+            names.push_back('\0');
+        }
+        entries.push_back({
+                info.id,
+                dbgLoc->getLine(),
+                dbgLoc->getColumn(),
+                bbInfo.at(info.instruction->getParent()).id,
+                info.shift,
+                it_and_state.first->second
+                });
+    }
+    std::sort(entries.begin(), entries.end(), [](auto const&  l, auto const&  r) { return l.id < r.id; });
+
+    instrumentation::dbg_map_header  header{};
+    std::copy(std::begin(header.magic_value), std::end(header.magic_value), header.magic);
+    header.version = instrumentation::dbg_map_header::current_version;
+    header.num_entries = (std::uint32_t)entries.size();
+    header.names_size = (std::uint32_t)names.size();
+
+    std::ofstream  ostr(pathname.c_str(), std::ios::binary);
+    ostr.write((char const*)&header, sizeof(header));
+    ostr.write((char const*)entries.data(), entries.size() * sizeof(instrumentation::dbg_map_entry));
+    ostr.write(names.data(), names.size());
+}
@@ -0,0 +1,29 @@
+#ifndef TOOL_INSTRUMENTER_DBG_MAPPING_HPP_INCLUDED
+#   define TOOL_INSTRUMENTER_DBG_MAPPING_HPP_INCLUDED
+
+#   include <instrumenter/llvm_instrumenter.hpp>
+#   include <filesystem>
+#   include <string>
+
+
+std::filesystem::path  dbg_mapping_pathname(
+        std::filesystem::path const&  output_dir,
+        std::string const&  benchmark_name,
+        std::string const&  type
+        );
+
+void  save_dbg_mapping(
+        llvm_instrumenter::instruction_dbg_info_vector const&  mapping,
+        llvm_instrumenter::basic_block_dbg_info_map const&  bbInfo,
+        std::filesystem::path const&  pathname
+        );
+
+// Saves the same mapping in the binary format of 'instrumentation::dbg_map', extended by function names.
+void  save_dbg_mapping_binary(
+        llvm_instrumenter::instruction_dbg_info_vector const&  mapping,
+        llvm_instrumenter::basic_block_dbg_info_map const&  bbInfo,
+        std::filesystem::path const&  pathname
+        );
+
+
+#endif
@@ -36,6 +36,10 @@ bool llvm_instrumenter::doInitialization(Module *M) {
         module->getOrInsertFunction("__sbt_fizzer_process_condition", VoidTy,
                               Int32Ty, Int1Ty, DoubleTy, Int1Ty, Int8Ty);
 
+    processCmpOperandsFunc =
+        module->getOrInsertFunction("__sbt_fizzer_process_cmp_operands", VoidTy,
+                              Int64Ty, Int64Ty, Int8Ty);
+
     processCondBrFunc =
         module->getOrInsertFunction("__sbt_fizzer_process_br_instr", VoidTy,
                               Int32Ty, Int1Ty);
@@ -50,6 +54,7 @@ bool llvm_instrumenter::doInitialization(Module *M) {
     basicBlockCounter = 0;
     condCounter = 0;
     callSiteCounter = 0;
+    cmpOperandsCounter = 0;
 
     return true;
 }
@@ -134,8 +139,31 @@ Value *llvm_instrumenter::instrumentCmp(CmpInst *cmpInst, IRBuilder<> &builder)
     return instrumentFcmp(lhs, rhs, cmpInst, builder);
 }
 
+// Passes the raw operands of an integer equality or magic-value comparison to the fuzzer,
+// so that it can search for them in the input and patch them directly. Must be called
+// right after the call to 'processCondFunc' of the same comparison.
+void llvm_instrumenter::instrumentCmpOperands(CmpInst *cmpInst, IRBuilder<> &builder) {
+    Value *lhs = cmpInst->getOperand(0);
+    Value *rhs = cmpInst->getOperand(1);
+
+    if (!cmpInst->isIntPredicate() || !lhs->getType()->isIntegerTy() || !rhs->getType()->isIntegerTy())
+        return;
+    unsigned int const numBits = lhs->getType()->getIntegerBitWidth();
+    if (numBits < 8U || numBits > 64U)
+        return;
+    if (!cmpInst->isEquality() && !isa<ConstantInt>(lhs) && !isa<ConstantInt>(rhs))
+        return;
+
+    ++cmpOperandsCounter;
+    builder.CreateCall(processCmpOperandsFunc, {
+        builder.CreateZExt(lhs, Int64Ty),
+        builder.CreateZExt(rhs, Int64Ty),
+        ConstantInt::get(Int8Ty, (numBits + 7U) / 8U)
+        });
+}
+
 
-bool llvm_instrumenter::instrumentCond(Instruction *inst, bool const xor_like_branching_function) {
+bool llvm_instrumenter::instrumentCond(Instruction *inst, bool const xor_like_branching_function, bool const cmp_operands) {
     if (!inst->getNextNode()) {
         return false;
     }
@@ -227,6 +255,10 @@ bool llvm_instrumenter::instrumentCond(Instruction *inst, bool const xor_like_br
         ConstantInt::get(Int8Ty, predicate)
         });
 
+    if (cmp_operands)
+        if (auto *cmpInst = dyn_cast<CmpInst>(inst))
+            instrumentCmpOperands(cmpInst, builder);
+
     return true;
 }
 
@@ -292,7 +324,7 @@ void llvm_instrumenter::instrumentCalls(Function &F) {
     }
 }
 
-bool llvm_instrumenter::runOnFunction(Function &F, bool const br_too) {
+bool llvm_instrumenter::runOnFunction(Function &F, bool const br_too, bool const cmp_operands) {
     TMPROF_BLOCK();
 
     if (F.isDeclaration()) {
@@ -331,7 +363,7 @@ bool llvm_instrumenter::runOnFunction(Function &F, bool const br_too) {
             }
 
             if (I.getType() == Int1Ty) {
-                if (instrumentCond(&I, xor_instr_detected))
+                if (instrumentCond(&I, xor_instr_detected, cmp_operands))
                     condInstrDbgInfo.push_back({ &I, condCounter, dbgShift });
             }
         }
@@ -56,12 +56,13 @@ struct llvm_instrumenter {
         std::unordered_map<std::string, llvm::FunctionCallee> replacements
     );
     void instrumentCalls(llvm::Function &F);
-    bool runOnFunction(llvm::Function &F, bool br_too);
+    bool runOnFunction(llvm::Function &F, bool br_too, bool cmp_operands = false);
 
     void printErrCond(llvm::Value *cond);
 
     void instrumentCondBr(llvm::BranchInst *brInst);
-    bool instrumentCond(llvm::Instruction *inst, bool xor_like_branching_function);
+    bool instrumentCond(llvm::Instruction *inst, bool xor_like_branching_function, bool cmp_operands);
+    void instrumentCmpOperands(llvm::CmpInst *cmpInst, llvm::IRBuilder<> &builder);
     llvm::Value *instrumentCmp(llvm::CmpInst *cmpInst, llvm::IRBuilder<> &builder);
     llvm::Value *instrumentIcmp(llvm::Value *lhs, llvm::Value *rhs, llvm::CmpInst *cmpInst,
                           llvm::IRBuilder<> &builder);
@@ -74,6 +75,13 @@ struct llvm_instrumenter {
     instruction_dbg_info_vector const&  getCondInstrDbgInfo() const { return condInstrDbgInfo; }
     instruction_dbg_info_vector const&  getBrInstrDbgInfo() const { return brInstrDbgInfo; }
 
+    // The ids assigned by the instrumenter are dense: 1, ..., getNum*().
+    unsigned int  getNumConditions() const { return condCounter; }
+    unsigned int  getNumBasicBlocks() const { return basicBlockCounter; }
+    unsigned int  getNumCallSites() const { return callSiteCounter; }
+    // The number of comparisons whose operands are passed to the fuzzer (see 'cmp_operands').
+    unsigned int  getNumCmpOperandsSites() const { return cmpOperandsCounter; }
+
 private:
 
     llvm::Module *module;
@@ -92,6 +100,7 @@ private:
     std::unique_ptr<llvm::legacy::FunctionPassManager> DependenciesFPM;
 
     llvm::FunctionCallee processCondFunc;
+    llvm::FunctionCallee processCmpOperandsFunc;
     llvm::FunctionCallee processCondBrFunc;
     llvm::FunctionCallee processCallBeginFunc;
     llvm::FunctionCallee processCallEndFunc;
@@ -99,6 +108,7 @@ private:
     unsigned int basicBlockCounter;
     unsigned int condCounter;
     unsigned int callSiteCounter;
+    unsigned int cmpOperandsCounter;
 
     basic_block_dbg_info_map basicBlockDbgInfo;
     instruction_dbg_info_vector condInstrDbgInfo;
@@ -0,0 +1,118 @@
+#include <instrumenter/llvm_instrumenter.hpp>
+#include <instrumenter/dbg_mapping.hpp>
+#include <instrumenter/target_metadata.hpp>
+#include <instrumentation/dbg_map.hpp>
+#include <utility/config.hpp>
+#if COMPILER() == COMPILER_VC()
+#    pragma warning(push)
+#    pragma warning(disable : 4624 4996 4146 4800 4996 4005 4355 4244 4267)
+#endif
+#include <llvm/IR/Module.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/raw_os_ostream.h>
+#if COMPILER() == COMPILER_VC()
+#    pragma warning(pop)
+#endif
+#include <filesystem>
+#include <fstream>
+#include <cstdlib>
+#include <string>
+
+// The instrumenter packaged as a pass plugin of the new pass manager, i.e. loadable by
+//      clang -fpass-plugin=<this library> ...
+// The module is instrumented at the start of clang's optimization pipeline, i.e. before any
+// optimization, so the result is the same as of the 'instrumenter' tool applied to the .ll file
+// clang would emit. The uninstrumented .ll file is neither written nor parsed again, and the
+// output of clang (e.g. bitcode for '-c -emit-llvm') is the instrumented module.
+// Since options passed via '-mllvm' are parsed before '-fpass-plugin' libraries are
+// loaded, the pass is configured via these environment variables:
+//      SBT_FIZZER_BR_TOO           When set, also conditional 'br' instructions are instrumented.
+//      SBT_FIZZER_CMP_OPERANDS     When set, also raw operands of integer comparisons are passed to the fuzzer.
+//      SBT_FIZZER_MAPPING_DIR      When set, the debug mapping files are saved into that directory.
+//      SBT_FIZZER_METADATA_DIR     When set, the target's metadata file is saved into that directory.
+//      SBT_FIZZER_OUTPUT_LL        When set, the instrumented module is also saved to that .ll file
+//                                  (e.g. for the progress recording).
+
+
+namespace {
+
+
+std::string  get_env(char const* const  name)
+{
+    char const* const  value = std::getenv(name);
+    return value == nullptr ? std::string{} : std::string{ value };
+}
+
+
+struct  instrumenter_pass : public llvm::PassInfoMixin<instrumenter_pass>
+{
+    llvm::PreservedAnalyses  run(llvm::Module&  M, llvm::ModuleAnalysisManager&)
+    {
+        bool const  br_too = std::getenv("SBT_FIZZER_BR_TOO") != nullptr;
+        bool const  cmp_operands = std::getenv("SBT_FIZZER_CMP_OPERANDS") != nullptr;
+        std::string const  mapping_dir = get_env("SBT_FIZZER_MAPPING_DIR");
+        std::string const  metadata_dir = get_env("SBT_FIZZER_METADATA_DIR");
+        std::string const  output_ll = get_env("SBT_FIZZER_OUTPUT_LL");
+
+        llvm_instrumenter  instrumenter;
+        instrumenter.doInitialization(&M);
+        instrumenter.renameFunctions();
+        for (auto it = M.begin(); it != M.end(); ++it)
+            instrumenter.runOnFunction(*it, br_too, cmp_operands);
+
+        std::string const  benchmark_name{ std::filesystem::path(M.getSourceFileName()).stem().string() };
+
+        if (!output_ll.empty())
+        {
+            std::ofstream  ostr(output_ll.c_str(), std::ios::binary);
+            llvm::raw_os_ostream ros(ostr);
+            M.print(ros, 0);
+            ros.flush();
+        }
+
+        if (!metadata_dir.empty())
+            save_target_metadata(instrumenter, target_metadata_pathname(metadata_dir, benchmark_name));
+
+        if (!mapping_dir.empty())
+        {
+            instrumenter.propagateMissingBasicBlockDbgInfo();
+            save_dbg_mapping(instrumenter.getCondInstrDbgInfo(), instrumenter.getBasicBlockDbgInfo(),
+                             dbg_mapping_pathname(mapping_dir, benchmark_name, "cond"));
+            save_dbg_mapping(instrumenter.getBrInstrDbgInfo(), instrumenter.getBasicBlockDbgInfo(),
+                             dbg_mapping_pathname(mapping_dir, benchmark_name, "br"));
+            save_dbg_mapping_binary(instrumenter.getCondInstrDbgInfo(), instrumenter.getBasicBlockDbgInfo(),
+                                    instrumentation::dbg_map_pathname(mapping_dir, benchmark_name, "cond"));
+            save_dbg_mapping_binary(instrumenter.getBrInstrDbgInfo(), instrumenter.getBasicBlockDbgInfo(),
+                                    instrumentation::dbg_map_pathname(mapping_dir, benchmark_name, "br"));
+        }
+
+        return llvm::PreservedAnalyses::none();
+    }
+
+    // The instrumentation must run also for -O0, where clang marks functions 'optnone'.
+    static bool  isRequired() { return true; }
+};
+
+
+}
+
+
+extern "C" LLVM_ATTRIBUTE_WEAK llvm::PassPluginLibraryInfo  llvmGetPassPluginInfo()
+{
+    return {
+        LLVM_PLUGIN_API_VERSION, "sbt-fizzer-instrumenter", LLVM_VERSION_STRING,
+        [](llvm::PassBuilder&  PB) {
+            PB.registerPipelineStartEPCallback(
+                [](llvm::ModulePassManager&  MPM, llvm::OptimizationLevel) {
+                    MPM.addPass(instrumenter_pass{});
+                });
+            PB.registerPipelineParsingCallback(
+                [](llvm::StringRef  name, llvm::ModulePassManager&  MPM, llvm::ArrayRef<llvm::PassBuilder::PipelineElement>) {
+                    if (name != "sbt-fizzer-instrumenter")
+                        return false;
+                    MPM.addPass(instrumenter_pass{});
+                    return true;
+                });
+        }
+    };
+}
@@ -8,6 +8,8 @@ program_options::program_options(int argc, char* argv[])
     add_option("input", "Pathname to the input .ll file.", "1");
     add_option("output", "Pathname to the output .ll file where the instrumented version of the input file will be stored.", "1");
     add_option("br_too", "Instrument also conditional 'br' instructions. This is necessary only for the communication with JetKlee.", "0");
+    add_option("cmp_operands", "Pass also the raw operands of integer equality and magic-value comparisons to the fuzzer. "
+               "They allow the fuzzer to patch input bytes holding one operand by the value of the other one.", "0");
     add_option("save_mapping", "When specified, there will be saved JSON files describing mapping from the instrumented "
                "instructions to the original C file. NOTE: Requires C file to be compiled with debug information.", "0");
 }
@@ -1,6 +1,9 @@
 #include <instrumenter/program_info.hpp>
 #include <instrumenter/program_options.hpp>
 #include <instrumenter/llvm_instrumenter.hpp>
+#include <instrumenter/dbg_mapping.hpp>
+#include <instrumenter/target_metadata.hpp>
+#include <instrumentation/dbg_map.hpp>
 #include <utility/config.hpp>
 #if COMPILER() == COMPILER_VC()
 #    pragma warning(push)
@@ -34,34 +37,10 @@ void dump_dbg_mapping(
         std::string const& type
         )
 {
-    TMPROF_BLOCK();
-
     std::filesystem::path const output_dir{ std::filesystem::path(get_program_options()->value("output")).parent_path() };
     std::filesystem::path const input_file_name { std::filesystem::path(get_program_options()->value("input")).filename().replace_extension("") };
-    std::filesystem::path pathname = output_dir / (input_file_name.string() + "_dbg_" + type + "_map.json");
-    std::ofstream  ostr(pathname.c_str(), std::ios::binary);
-    ostr << "{";
-    bool started { false }; 
-    for (auto const&  info : mapping) {
-        if (started) ostr << ','; else started = true;
-        llvm::DILocation const *dbgLoc = info.instruction->getDebugLoc();
-        if (dbgLoc == nullptr)
-            dbgLoc = bbInfo.at(info.instruction->getParent()).info;
-        if (dbgLoc == nullptr)
-        {
-            std::cerr << "Retrieval of debug information for the instruction #" << info.id << "has FAILED!\n";
-            continue;
-        }
-        ostr << '\n'
-                << '"' << info.id << "\": [ "
-                << dbgLoc->getLine() << ", "
-                << dbgLoc->getColumn() << ", "
-                << bbInfo.at(info.instruction->getParent()).id << ", "
-                << info.shift
-            << " ]"
-                ;
-    }
-    ostr << "\n}\n";
+    save_dbg_mapping(mapping, bbInfo, dbg_mapping_pathname(output_dir, input_file_name.string(), type));
+    save_dbg_mapping_binary(mapping, bbInfo, instrumentation::dbg_map_pathname(output_dir, input_file_name.string(), type));
 }
 
 
@@ -115,7 +94,7 @@ void run(int argc, char* argv[])
     instrumenter.doInitialization(M.get());
     instrumenter.renameFunctions();
     for (auto it = M->begin(); it != M->end(); ++it)
-        instrumenter.runOnFunction(*it, get_program_options()->has("br_too"));
+        instrumenter.runOnFunction(*it, get_program_options()->has("br_too"), get_program_options()->has("cmp_operands"));
 
     {
         TMPROF_BLOCK();
@@ -126,6 +105,14 @@ void run(int argc, char* argv[])
         ros.flush();
     }
 
+    save_target_metadata(
+            instrumenter,
+            target_metadata_pathname(
+                    std::filesystem::path(get_program_options()->value("output")).parent_path(),
+                    std::filesystem::path(get_program_options()->value("input")).filename().replace_extension("").string()
+                    )
+            );
+
     if (get_program_options()->has("save_mapping"))
     {
         instrumenter.propagateMissingBasicBlockDbgInfo();
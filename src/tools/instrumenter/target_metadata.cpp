@@ -0,0 +1,20 @@
+#include <instrumenter/target_metadata.hpp>
+#include <fstream>
+
+
+std::filesystem::path  target_metadata_pathname(std::filesystem::path const&  output_dir, std::string const&  benchmark_name)
+{
+    return output_dir / (benchmark_name + "_metadata.json");
+}
+
+
+void  save_target_metadata(llvm_instrumenter const&  instrumenter, std::filesystem::path const&  pathname)
+{
+    std::ofstream  ostr(pathname.c_str(), std::ios::binary);
+    ostr << "{\n"
+         << "    \"num_cond_locations\": " << instrumenter.getNumConditions() << ",\n"
+         << "    \"num_br_locations\": " << instrumenter.getNumBasicBlocks() << ",\n"
+         << "    \"num_call_sites\": " << instrumenter.getNumCallSites() << ",\n"
+         << "    \"num_cmp_operands_sites\": " << instrumenter.getNumCmpOperandsSites() << "\n"
+         << "}\n";
+}
@@ -0,0 +1,15 @@
+#ifndef TOOL_INSTRUMENTER_TARGET_METADATA_HPP_INCLUDED
+#   define TOOL_INSTRUMENTER_TARGET_METADATA_HPP_INCLUDED
+
+#   include <instrumenter/llvm_instrumenter.hpp>
+#   include <filesystem>
+#   include <string>
+
+
+std::filesystem::path  target_metadata_pathname(std::filesystem::path const&  output_dir, std::string const&  benchmark_name);
+
+// Saves the sizes of the location id spaces, so that the server can index per-location data directly.
+void  save_target_metadata(llvm_instrumenter const&  instrumenter, std::filesystem::path const&  pathname);
+
+
+#endif
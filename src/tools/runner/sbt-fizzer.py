@@ -4,6 +4,7 @@ import sys
 import os
 import time
 import shutil
+import hashlib
 from datetime import datetime
 
 
@@ -29,6 +30,10 @@ def  benchmark_instrumented_ll_name(input_file):
     return benchmark_name(input_file) + "_instrumented.ll"
 
 
+def  benchmark_instrumented_bc_name(input_file):
+    return benchmark_name(input_file) + "_instrumented.bc"
+
+
 def  benchmark_target_name(input_file):
     return benchmark_name(input_file) + "_sbt-fizzer_target"
 
@@ -37,6 +42,13 @@ def  benchmark_sala_name(input_file):
     return benchmark_name(input_file) + "_sala" + ".json"
 
 
+def get_fuzz_target_libraries(self_dir, use_m32):
+    return list(map( # type: ignore
+        lambda lib_name: os.path.join(self_dir, "lib32" if use_m32 is True else "lib", lib_name).replace("\\", "/"), 
+        @FUZZ_TARGET_LIBRARIES_FILES_LIST@ # type: ignore
+        ))
+
+
 def build(self_dir, input_file, output_dir, options, use_m32, generate_jsonc, silent_mode):
     ll_file = os.path.join(output_dir, benchmark_ll_name(input_file))
 
@@ -64,10 +76,7 @@ def build(self_dir, input_file, output_dir, options, use_m32, generate_jsonc, si
     t1 = time.time()
     if silent_mode is False: print("%.2f," % (t1 - t0), flush=True)
 
-    fuzz_target_libraries = list(map( # type: ignore
-        lambda lib_name: os.path.join(self_dir, "lib32" if use_m32 is True else "lib", lib_name).replace("\\", "/"), 
-        @FUZZ_TARGET_LIBRARIES_FILES_LIST@ # type: ignore
-        ))
+    fuzz_target_libraries = get_fuzz_target_libraries(self_dir, use_m32)
     target_file = os.path.join(output_dir, benchmark_target_name(input_file))
 
     if silent_mode is False: print("    \"Linking\": ", end='', flush=True)
@@ -95,10 +104,131 @@ def build(self_dir, input_file, output_dir, options, use_m32, generate_jsonc, si
                 "--entry", "__sbt_fizzer_method_under_test" ],
             None).returncode:
         if silent_mode is False: print("},", flush=True)
-        return 
+        return False
+    t1 = time.time()
+    if silent_mode is False: print("%.2f" % (t1 - t0), flush=True)
+    if silent_mode is False: print("},", flush=True)
+    return True
+
+
+# The plugin instruments the module at the start of clang's pipeline, i.e. the same -O0 code
+# as the 'instrumenter' tool does in 'build'. The module clang then emits is the instrumented
+# one, so it is written as bitcode and passed to the -O3 link step and to the Sala compiler
+# as it is; no textual LLVM file is printed and parsed again. The instrumented .ll file is
+# saved only for the progress recording, which copies it to its output.
+def build_with_pass_plugin(self_dir, input_file, output_dir, options, use_m32, generate_jsonc, save_ll, silent_mode):
+    instrumented_bc_file = os.path.join(output_dir, benchmark_instrumented_bc_name(input_file))
+
+    plugin_env = dict(os.environ)
+    plugin_env["SBT_FIZZER_METADATA_DIR"] = output_dir
+    if save_ll is True:
+        plugin_env["SBT_FIZZER_OUTPUT_LL"] = os.path.join(output_dir, benchmark_instrumented_ll_name(input_file))
+    if "--br_too" in options:
+        plugin_env["SBT_FIZZER_BR_TOO"] = "1"
+    if "--cmp_operands" in options:
+        plugin_env["SBT_FIZZER_CMP_OPERANDS"] = "1"
+    if "--save_mapping" in options:
+        plugin_env["SBT_FIZZER_MAPPING_DIR"] = output_dir
+
+    if os.path.isfile(instrumented_bc_file):
+        os.remove(instrumented_bc_file)
+
+    if silent_mode is False: print("\"build_times\": {", flush=True)
+    if silent_mode is False: print("    \"Compiling+Instrumenting[C->LLVM]\": ", end='', flush=True)
+    t0 = time.time()
+    if subprocess.run(
+            [ "clang" ] +
+                (["-m32"] if use_m32 is True else []) +
+                [ "-O0", "-g", "-c", "-emit-llvm", "-Wno-everything", "-fbracket-depth=1024",
+                  "-fpass-plugin=" + os.path.join(self_dir, "tools", "@FIZZER_INSTRUMENTER_PLUGIN_FILE@"),
+                  input_file, "-o", instrumented_bc_file],
+            env=plugin_env).returncode or not os.path.isfile(instrumented_bc_file):
+        raise Exception("Compilation+Instrumentation[C->LLVM] has failed: " + input_file)
+    t1 = time.time()
+    if silent_mode is False: print("%.2f," % (t1 - t0), flush=True)
+
+    fuzz_target_libraries = get_fuzz_target_libraries(self_dir, use_m32)
+    target_file = os.path.join(output_dir, benchmark_target_name(input_file))
+
+    if silent_mode is False: print("    \"Linking\": ", end='', flush=True)
+    t0 = time.time()
+    if _execute(
+            [ "clang++" ] +
+                (["-m32"] if use_m32 is True else []) +
+                [ "-O3", instrumented_bc_file ] +
+                "@FUZZ_TARGET_NEEDED_COMPILATION_FLAGS@".split() +
+                fuzz_target_libraries +
+                [ "-o", target_file ],
+            None).returncode:
+        raise Exception("Linking has failed: " + input_file)
+    t1 = time.time()
+    if silent_mode is False: print("%.2f," % (t1 - t0), flush=True)
+
+    # The Sala compiler reads the module by LLVM, which accepts bitcode as well as the textual form.
+    if silent_mode is False: print("    \"Compiling[LLVM->sala]\": ", end='', flush=True)
+    t0 = time.time()
+    if _execute(
+            [ os.path.join(self_dir, "tools", "salac", "salac.py") ] +
+                (["--jsonc"] if generate_jsonc is True else []) + [
+                "--input", instrumented_bc_file,
+                "--output", output_dir,
+                "--rename", os.path.splitext(benchmark_sala_name(input_file))[0],
+                "--entry", "__sbt_fizzer_method_under_test" ],
+            None).returncode:
+        if silent_mode is False: print("},", flush=True)
+        return False
     t1 = time.time()
     if silent_mode is False: print("%.2f" % (t1 - t0), flush=True)
     if silent_mode is False: print("},", flush=True)
+    return True
+
+
+def build_cache_key(self_dir, input_file, options, use_m32, generate_jsonc, use_pass_plugin, save_ll):
+    h = hashlib.sha256()
+    with open(input_file, "rb") as f:
+        h.update(f.read())
+    h.update(" ".join(options + [str(use_m32), str(generate_jsonc), str(use_pass_plugin), str(save_ll)]).encode())
+    # A rebuilt instrumenter, runtime library or Sala compiler must invalidate the cached results.
+    tool = "@FIZZER_INSTRUMENTER_PLUGIN_FILE@" if use_pass_plugin is True else "@FIZZER_INSTRUMENTER_FILE@"
+    pathnames = [ os.path.join(self_dir, "tools", tool) ] + get_fuzz_target_libraries(self_dir, use_m32)
+    salac_dir = os.path.join(self_dir, "tools", "salac")
+    for root, dirs, files in os.walk(salac_dir):
+        dirs.sort()
+        pathnames += [ os.path.join(root, name) for name in sorted(files) ]
+    for pathname in pathnames:
+        h.update(os.path.relpath(pathname, self_dir).encode())
+        with open(pathname, "rb") as f:
+            h.update(f.read())
+    return h.hexdigest()
+
+
+def build_cached(self_dir, input_file, output_dir, cache_dir, options, use_m32, generate_jsonc, use_pass_plugin, save_ll, silent_mode):
+    entry_dir = os.path.join(cache_dir, build_cache_key(self_dir, input_file, options, use_m32, generate_jsonc, use_pass_plugin, save_ll))
+    if os.path.isdir(entry_dir):
+        for name in os.listdir(entry_dir):
+            shutil.copy2(os.path.join(entry_dir, name), output_dir)
+        if silent_mode is False: print("\"build_cache\": \"hit\",", flush=True)
+        return
+
+    start_time = time.time()
+    if use_pass_plugin is True:
+        success = build_with_pass_plugin(self_dir, input_file, output_dir, options, use_m32, generate_jsonc, save_ll, silent_mode)
+    else:
+        success = build(self_dir, input_file, output_dir, options, use_m32, generate_jsonc, silent_mode)
+    # Failed steps raise an exception, except for the Sala compiler. A partial build is not cached.
+    if success is False:
+        if silent_mode is False: print("\"build_cache\": \"miss\",", flush=True)
+        return
+
+    tmp_entry_dir = entry_dir + ".tmp" + str(os.getpid())
+    os.makedirs(tmp_entry_dir, exist_ok=True)
+    for name in os.listdir(output_dir):
+        pathname = os.path.join(output_dir, name)
+        if name.startswith(benchmark_name(input_file)) and os.path.isfile(pathname) and os.path.getmtime(pathname) >= start_time:
+            shutil.copy2(pathname, tmp_entry_dir)
+    try: os.rename(tmp_entry_dir, entry_dir)
+    except OSError: shutil.rmtree(tmp_entry_dir, ignore_errors=True)
+    if silent_mode is False: print("\"build_cache\": \"miss\",", flush=True)
 
 
 def adjust_timeouts(options, start_time, silent_mode):
@@ -201,6 +331,13 @@ def help(self_dir):
     print("                     32-bit machine (cpu). Otherwise, 64-bit machine is assumed.")
     print("jsonc                When specified, Sala program with comments will be")
     print("                     generated together with the standard one.")
+    print("use_pass_plugin      When specified, the C file is instrumented by the instrumenter")
+    print("                     loaded into clang as a pass plugin (-fpass-plugin), instead of")
+    print("                     by a separate tool reading the LLVM file written by clang.")
+    print("build_cache_dir <PATH>")
+    print("                     When specified, the build results are cached in the directory")
+    print("                     under a hash of the source file, the options, the instrumenter,")
+    print("                     the runtime libraries and the Sala compiler.")
     print("\nNext follows a listing of options of tools called from this script. When they are")
     print("passed to the script they will automatically be propagated to the corresponding tool.")
 
@@ -233,6 +370,8 @@ def main():
     generate_testcomp_metadata = False
     use_m32 = False
     generate_jsonc = False
+    use_pass_plugin = False
+    build_cache_dir = None
     options = []
     options_instument = []
     i = 1
@@ -268,12 +407,18 @@ def main():
             skip_building = True
         elif arg == "--skip_fuzzing":
             skip_fuzzing = True
-        elif arg in [ "--save_mapping", "--br_too" ]:
+        elif arg in [ "--save_mapping", "--br_too", "--cmp_operands" ]:
             options_instument.append(arg)
         elif arg == "--m32":
             use_m32 = True
         elif arg == "--jsonc":
             generate_jsonc = True
+        elif arg == "--use_pass_plugin":
+            use_pass_plugin = True
+        elif arg == "--build_cache_dir" and i+1 < len(sys.argv):
+            build_cache_dir = os.path.normpath(os.path.abspath(sys.argv[i+1]))
+            os.makedirs(build_cache_dir, exist_ok=True)
+            i += 1
         else:
             options.append(arg)
         i += 1
@@ -291,7 +436,12 @@ def main():
             raise Exception("Cannot find the input file.")
         if silent_mode is False: print("### starting fizzer's pipeline ###\n{", flush=True)
         if skip_building is False:
-            build(self_dir, input_file, output_dir, options_instument, use_m32, generate_jsonc, silent_mode)
+            if build_cache_dir is not None:
+                build_cached(self_dir, input_file, output_dir, build_cache_dir, options_instument, use_m32, generate_jsonc, use_pass_plugin, copy_source_file, silent_mode)
+            elif use_pass_plugin is True:
+                build_with_pass_plugin(self_dir, input_file, output_dir, options_instument, use_m32, generate_jsonc, copy_source_file, silent_mode)
+            else:
+                build(self_dir, input_file, output_dir, options_instument, use_m32, generate_jsonc, silent_mode)
             adjust_timeouts(options, start_time, silent_mode)
         if skip_fuzzing is False:
             if generate_testcomp_metadata is True:
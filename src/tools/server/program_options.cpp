@@ -3,6 +3,7 @@
 #include <iomodels/iomanager.hpp>
 #include <fuzzing/termination_info.hpp>
 #include <fuzzing/optimizer.hpp>
+#include <fuzzing/checkpoint.hpp>
 #include <utility/assumptions.hpp>
 
 program_options::program_options(int argc, char* argv[])
@@ -24,6 +25,28 @@ program_options::program_options(int argc, char* argv[])
     add_option("max_seconds", "Max number of seconds for fuzzing the benchmark.", "1");
     add_value("max_seconds", std::to_string(terminator.max_seconds));
 
+    add_option("max_server_megabytes", "Max number of mega bytes of memory used by the server for fuzzing data (0 means no limit). "
+                                       "When exceeded, traces of tree nodes are evicted and rebuilt on demand by re-execution.", "1");
+    add_value("max_server_megabytes", std::to_string(terminator.max_server_megabytes));
+
+    add_option("lossy_eviction", "Allow eviction of fuzzing data which cannot be rebuilt (bitshare samples) "
+                                 "to meet 'max_server_megabytes'. Coverage results may then differ.", "0");
+
+    add_option("execution_cache_megabytes", "Max number of mega bytes of results of executions kept, so that an input "
+                                            "generated again is not executed again (0 means no cache).", "1");
+    add_value("execution_cache_megabytes", std::to_string(terminator.execution_cache_megabytes));
+
+    add_option("max_local_searches", "Max number of local searches running at once, each on a different node. "
+                                     "Their inputs are generated in turns.", "1");
+    add_value("max_local_searches", std::to_string(terminator.max_local_searches));
+
+    add_option("random_seed", "The seed of all random generators of the fuzzer and of its analyses.", "1");
+    add_value("random_seed", std::to_string(terminator.random_seed));
+
+    add_option("deterministic", "Replace decisions depending on the elapsed time or on timing of threads by ones "
+                                "depending on the number of executions. Then runs with the same 'max_executions' "
+                                "produce the same tests.", "0");
+
     iomodels::configuration const  io_cfg{};
 
     add_option("max_trace_length", "Max number of branchings in a trace.", "1");
@@ -91,6 +114,15 @@ program_options::program_options(int argc, char* argv[])
 
     add_option("progress_recording", "When specified, all inputs generated by all analyses and corresponding execution traces "
                                      "will be recorded to the disk, per each analysis run and in the chronological order.", "0");
+    add_option("seed_dir", "A directory with tests (native '*.json' or Test-Comp '*.xml' files, searched recursively), "
+                           "e.g. from a previous run. Their inputs are executed first, so fuzzing starts from their coverage.", "1");
+    add_option("checkpoint", "A file where to periodically save the state of fuzzing, so the fuzzing can be later resumed "
+                             "from it (see the option 'resume'). The state is saved also on SIGTERM and then fuzzing stops. "
+                             "When not specified and 'resume' is, the resumed file is used.", "1");
+    add_option("checkpoint_seconds", "The period of saving the checkpoint in seconds (0 means only on SIGTERM).", "1");
+    add_value("checkpoint_seconds", std::to_string(fuzzing::checkpoint_config{}.period_seconds));
+    add_option("resume", "A checkpoint file from which fuzzing continues. Other options must be the same as in the run "
+                         "which saved the checkpoint; the output directory should be kept too.", "1");
     add_option("silent_mode", "Reduce the amount of messages printed to stdout.", "0");
     add_option("render", "Render fuzzing state to stdout in each round of fuzzing loop.", "0");
 }
@@ -4,11 +4,16 @@
 #include <iomodels/iomanager.hpp>
 #include <iomodels/models_map.hpp>
 #include <fuzzing/analysis_outcomes.hpp>
+#include <fuzzing/campaign_context.hpp>
+#include <fuzzing/checkpoint.hpp>
+#include <fuzzing/dbg_map.hpp>
 #include <fuzzing/fuzzing_loop.hpp>
 #include <fuzzing/execution_record_writer.hpp>
 #include <fuzzing/optimization_outcomes.hpp>
 #include <fuzzing/optimizer.hpp>
 #include <fuzzing/progress_recorder.hpp>
+#include <fuzzing/seed_corpus.hpp>
+#include <fuzzing/target_metadata.hpp>
 #include <fuzzing/dump.hpp>
 #include <fuzzing/dump_native.hpp>
 #include <fuzzing/dump_testcomp.hpp>
@@ -17,6 +22,13 @@
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <csignal>
+
+static volatile std::sig_atomic_t  checkpoint_stop_request{ 0 };
+extern "C" void  on_checkpoint_stop_request(int)
+{
+    checkpoint_stop_request = 1;
+}
 
 
 void run(int argc, char* argv[])
@@ -121,12 +133,33 @@ void run(int argc, char* argv[])
 
     fuzzing::termination_info  terminator{
             .max_executions = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("max_executions"))),
-            .max_seconds = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("max_seconds")))
+            .max_seconds = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("max_seconds"))),
+            .max_server_megabytes = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("max_server_megabytes"))),
+            .lossy_eviction = get_program_options()->has("lossy_eviction"),
+            .execution_cache_megabytes = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("execution_cache_megabytes"))),
+            .max_local_searches = (natural_32_bit)std::max(1, std::stoi(get_program_options()->value("max_local_searches"))),
+            .random_seed = (natural_32_bit)std::stoul(get_program_options()->value("random_seed")),
+            .deterministic = get_program_options()->has("deterministic")
             };
 
-    iomodels::iomanager::instance().set_config({
+    fuzzing::target_metadata  target_metadata;
+    if (get_program_options()->value("path_to_target").ends_with("_sbt-fizzer_target"))
+    {
+        std::filesystem::path const  metadata_path{
+                get_program_options()->value("path_to_target").substr(0,
+                        get_program_options()->value("path_to_target").rfind("_sbt-fizzer_target")
+                        ) + "_metadata.json"
+                };
+        if (std::filesystem::is_regular_file(metadata_path) && !fuzzing::load_target_metadata(metadata_path, target_metadata))
+            std::cerr << "WARNING: Failed to load the target metadata file '" << metadata_path << "'.\n";
+    }
+
+    fuzzing::campaign_context  context;
+
+    context.io.set_config({
             .max_exec_milliseconds = (natural_16_bit)std::max(0, std::stoi(get_program_options()->value("max_exec_milliseconds"))),
             .max_trace_length = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("max_trace_length"))),
+            .cmp_operands = target_metadata.num_cmp_operands_sites != 0U,
             .max_br_instr_trace_length = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("max_br_instr_trace_length"))),
             .max_stack_size = (natural_16_bit)std::max(0, std::stoi(get_program_options()->value("max_stack_size"))),
             .max_stdin_bytes = (iomodels::stdin_base::byte_count_type)std::max(0, std::stoi(get_program_options()->value("max_stdin_bytes"))),
@@ -144,19 +177,19 @@ void run(int argc, char* argv[])
             .max_exec_milliseconds = (natural_16_bit)std::max(0, std::stoi(get_program_options()->value("optimizer_max_exec_milliseconds"))),
             .max_exec_megabytes = (natural_16_bit)std::max(0, std::stoi(get_program_options()->value("optimizer_max_exec_megabytes")))
             };
-    if (optimizer_config.max_seconds > 0U && optimizer_config.max_trace_length <= iomodels::iomanager::instance().get_config().max_trace_length)
+    if (optimizer_config.max_seconds > 0U && optimizer_config.max_trace_length <= context.io.get_config().max_trace_length)
     {
         std::cerr << "ERROR: The 'optimizer_max_trace_length' must be greater than 'max_trace_length'.\n";
         return;
     }
-    if (optimizer_config.max_seconds > 0U && optimizer_config.max_stdin_bytes <= iomodels::iomanager::instance().get_config().max_stdin_bytes)
+    if (optimizer_config.max_seconds > 0U && optimizer_config.max_stdin_bytes <= context.io.get_config().max_stdin_bytes)
     {
         std::cerr << "ERROR: The 'optimizer_max_stdin_bytes' must be greater than 'max_stdin_bytes'.\n";
         return;
     }
 
     if (get_program_options()->has("progress_recording")) {
-        fuzzing::recorder().start(std::filesystem::absolute(get_program_options()->value("path_to_target")), output_dir);
+        context.recorder.start(std::filesystem::absolute(get_program_options()->value("path_to_target")), output_dir);
     }
 
     std::string  target_name = std::filesystem::path(get_program_options()->value("path_to_target")).filename().string();
@@ -175,6 +208,7 @@ void run(int argc, char* argv[])
             std::cout << "\"communication_type\": \"network\"," << std::endl;
 
         benchmark_executor = std::make_shared<connection::benchmark_executor_via_network>(
+                context.io,
                 get_program_options()->value("path_to_client"),
                 get_program_options()->value("path_to_target"),
                 get_program_options()->value_as_int("port")
@@ -186,6 +220,7 @@ void run(int argc, char* argv[])
             std::cout << "\"communication_type\": \"shared_memory\"," << std::endl;
 
         benchmark_executor = std::make_shared<connection::benchmark_executor_via_shared_memory>(
+                context.io,
                 get_program_options()->value("path_to_target")
                 );
     }
@@ -214,6 +249,23 @@ void run(int argc, char* argv[])
         }
     }
 
+    std::vector<vecu8>  seed_inputs;
+    std::size_t  num_skipped_seed_files{ 0UL };
+    if (get_program_options()->has("seed_dir"))
+    {
+        std::filesystem::path const  seed_dir = std::filesystem::absolute(get_program_options()->value("seed_dir"));
+        if (!std::filesystem::is_directory(seed_dir))
+        {
+            std::cerr << "ERROR: The passed seed directory '" << seed_dir << "' does not reference a directory.\n";
+            return;
+        }
+        num_skipped_seed_files = fuzzing::load_seed_inputs(seed_dir, seed_inputs);
+        // Longer inputs cannot be passed to the target.
+        std::erase_if(seed_inputs, [&context](vecu8 const&  bytes) {
+            return bytes.size() > context.io.get_config().max_stdin_bytes;
+            });
+    }
+
     auto const startup_time = std::chrono::duration<float_64_bit>(std::chrono::system_clock::now() - start_time_point).count();
 
     {
@@ -225,6 +277,9 @@ void run(int argc, char* argv[])
         if (!get_program_options()->has("silent_mode"))
             std::cout << "\"fuzzing_startup\": {" << std::endl
                       << "    \"time\": " << startup_time << ',' << std::endl
+                      << "    \"num_cond_locations\": " << target_metadata.num_cond_locations << ',' << std::endl
+                      << "    \"num_seed_inputs\": " << seed_inputs.size() << ',' << std::endl
+                      << "    \"num_skipped_seed_files\": " << num_skipped_seed_files << ',' << std::endl
                       << "    \"--max_seconds\": " << terminator.max_seconds << ',' << std::endl
                       << "    \"--optimizer_max_seconds\": " << optimizer_config.max_seconds << std::endl
                       << "}," << std::endl;
@@ -243,33 +298,57 @@ void run(int argc, char* argv[])
         fuzzing::print_fuzzing_configuration(
                 std::cout,
                 target_name,
-                iomodels::iomanager::instance().get_config(),
+                context.io.get_config(),
                 terminator
                 );
         std::cout << ',' << std::endl;
     }
     fuzzing::log_fuzzing_configuration(
             target_name,
-            iomodels::iomanager::instance().get_config(),
+            context.io.get_config(),
             terminator
             );
     fuzzing::save_fuzzing_configuration(
             output_dir, 
             target_name,
-            iomodels::iomanager::instance().get_config(),
+            context.io.get_config(),
             terminator
             );
 
+    fuzzing::checkpoint_config  checkpoints{
+            .pathname = get_program_options()->has("checkpoint") ?
+                            std::filesystem::absolute(get_program_options()->value("checkpoint")) :
+                        get_program_options()->has("resume") ?
+                            std::filesystem::absolute(get_program_options()->value("resume")) :
+                            std::filesystem::path{},
+            .period_seconds = (natural_32_bit)std::max(0, std::stoi(get_program_options()->value("checkpoint_seconds"))),
+            .resume_pathname = get_program_options()->has("resume") ?
+                                    std::filesystem::absolute(get_program_options()->value("resume")) :
+                                    std::filesystem::path{},
+            .stop_request = &checkpoint_stop_request
+            };
+    if (!checkpoints.resume_pathname.empty() && !std::filesystem::is_regular_file(checkpoints.resume_pathname))
+    {
+        std::cerr << "ERROR: The passed checkpoint path '" << checkpoints.resume_pathname << "' does not reference a regular file.\n";
+        return;
+    }
+    if (!checkpoints.pathname.empty())
+        std::signal(SIGTERM, on_checkpoint_stop_request);
+
     std::vector<vecu8>  inputs_leading_to_boundary_violation;
     fuzzing::analysis_outcomes const results = fuzzing::run(
+        context,
         *benchmark_executor,
         sala_program_ptr.get(),
+        target_metadata,
         execution_record_writer,
         [&inputs_leading_to_boundary_violation, &optimizer_config](fuzzing::execution_record const&  record) {
                 if (optimizer_config.max_seconds > 0)
                     inputs_leading_to_boundary_violation.push_back(record.stdin_bytes);
                 },
         terminator,
+        seed_inputs,
+        checkpoints,
         !get_program_options()->has("silent_mode") && get_program_options()->has("render")
         );
 
@@ -280,10 +359,26 @@ void run(int argc, char* argv[])
     }
     fuzzing::log_analysis_outcomes(results);
     fuzzing::save_analysis_outcomes(output_dir, target_name, results);
+    {
+        // The debug map is there only when the target was built with '--save_mapping'.
+        std::filesystem::path const  cond_map_path{ instrumentation::dbg_map_pathname(
+                std::filesystem::absolute(get_program_options()->value("path_to_target")).parent_path(), target_name, "cond"
+                ) };
+        if (std::filesystem::is_regular_file(cond_map_path))
+            try
+            {
+                fuzzing::save_uncovered_locations(output_dir, target_name, results, fuzzing::dbg_map{ cond_map_path });
+            }
+            catch (std::exception const&  e)
+            {
+                std::cerr << "WARNING: " << e.what() << "\n";
+            }
+    }
 
-    fuzzing::recorder().stop();
+    context.recorder.stop();
 
-    if (!inputs_leading_to_boundary_violation.empty() && optimizer_config.max_seconds > 0)
+    if (!inputs_leading_to_boundary_violation.empty() && optimizer_config.max_seconds > 0 &&
+            results.termination_type != fuzzing::analysis_outcomes::TERMINATION_TYPE::INTERRUPTED)
     {
         if (!get_program_options()->has("silent_mode"))
         {
@@ -295,17 +390,17 @@ void run(int argc, char* argv[])
         fuzzing::log_optimization_configuration(optimizer_config);
         fuzzing::save_optimization_configuration(output_dir, target_name, optimizer_config);
 
-        fuzzing::optimizer  opt{ optimizer_config };
+        fuzzing::optimizer  opt{ context, optimizer_config };
 
         {
-            iomodels::configuration  io_cfg = iomodels::iomanager::instance().get_config();
+            iomodels::configuration  io_cfg = context.io.get_config();
             io_cfg.max_trace_length = optimizer_config.max_trace_length;
             io_cfg.max_br_instr_trace_length = optimizer_config.max_br_instr_trace_length;
             io_cfg.max_stack_size = optimizer_config.max_stack_size;
             io_cfg.max_stdin_bytes = optimizer_config.max_stdin_bytes;
             io_cfg.max_exec_milliseconds = optimizer_config.max_exec_milliseconds;
             io_cfg.max_exec_megabytes = optimizer_config.max_exec_megabytes;
-            iomodels::iomanager::instance().set_config(io_cfg);
+            context.io.set_config(io_cfg);
             benchmark_executor->on_io_config_changed();
         }
 